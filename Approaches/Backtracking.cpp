@@ -7,28 +7,26 @@
 #include <limits>
 #include <iostream>
 
-// variables to track progress (used only in backtracking)
-static unsigned long long g_nodes_visited = 0;
-static unsigned long long g_total_nodes = 0;
-static ProgressBar* g_progress = nullptr;
-static bool g_user_cancelled = false;
-
-void knapsackBTRec(unsigned int profits[], unsigned int weights[],
+void knapsackBTRec(const unsigned int profits[], const unsigned int weights[],
                   unsigned int n, unsigned int curIndex,
                   unsigned int max_weight, unsigned int curWeight, 
                   unsigned int curProfit, unsigned int curCount, 
-                  std::vector<bool> &curItems, BTSol &bestSolution) {
+                  std::vector<bool> &curItems, BTSol &bestSolution, BTSearch &search) {
     
-    if (g_user_cancelled) {
+    if (search.stopped) {
         return;
     }
     
-    g_nodes_visited++;
+    search.nodes_visited++;
     
-    if (g_nodes_visited % 10000 == 0 && g_progress != nullptr) {
+    if (search.nodes_visited % 10000 == 0) {
         // update returns false if user pressed escape
-        if (!g_progress->update(g_nodes_visited)) {
-            g_user_cancelled = true;
+        if (search.progress != nullptr && !search.progress->update(search.nodes_visited)) {
+            search.user_cancelled = true;
+            search.stop.request_stop();
+        }
+        search.stopped = search.user_cancelled || search.stop.stop_requested();
+        if (search.stopped) {
             return;
         }
     }
@@ -49,7 +47,7 @@ void knapsackBTRec(unsigned int profits[], unsigned int weights[],
         return;
     }
     
-    if (curWeight + weights[curIndex] <= max_weight) {
+    if (curWeight + weights[curIndex] <= max_weight && (search.max_pallets == 0 || curCount < search.max_pallets)) {
         curItems[curIndex] = true;
         knapsackBTRec(
             profits, weights, n, 
@@ -59,7 +57,8 @@ void knapsackBTRec(unsigned int profits[], unsigned int weights[],
             curProfit + profits[curIndex],
             curCount + 1,
             curItems, 
-            bestSolution
+            bestSolution,
+            search
         );
         curItems[curIndex] = false; // backtrack
     }
@@ -72,27 +71,28 @@ void knapsackBTRec(unsigned int profits[], unsigned int weights[],
         curProfit,
         curCount,
         curItems, 
-        bestSolution
+        bestSolution,
+        search
     );
 }
 
-BTSol knapsackBT(unsigned int profits[], unsigned int weights[],
-                unsigned int n, unsigned int max_weight) {
+BTSol knapsackBT(const unsigned int profits[], const unsigned int weights[],
+                unsigned int n, unsigned int max_weight, unsigned int max_pallets,
+                std::stop_source stop) {
     
 
     BTSol bestSolution = {0, 0, 0, std::vector<bool>(n, false)};
  
     std::vector<bool> curItems(n, false);
     
-    // reset and initialize global progress tracking variables
-    g_nodes_visited = 0;
-    g_user_cancelled = false;
+    // progress and cancellation live with this call, so concurrent searches never share them
+    BTSearch search = {0, nullptr, max_pallets, stop, false, false};
     
     // only for extremely large datasets (like dataset 6 with 4000+ pallets)
     if (n > 1000) {
         // create a hidden progress bar for cancellation detection
         ProgressBar hiddenProgress(1, true);
-        g_progress = &hiddenProgress;
+        search.progress = &hiddenProgress;
         
         // coffee message :)
         hiddenProgress.showLargeDatasetMessage();
@@ -103,18 +103,19 @@ BTSol knapsackBT(unsigned int profits[], unsigned int weights[],
             max_weight,
             0, 0, 0,
             curItems,
-            bestSolution
+            bestSolution,
+            search
         );
         
-        if (!g_user_cancelled) {
+        if (!search.stopped && !ProgressBar::isHeadless()) {
             std::cout << "\nFinished! Hope you enjoyed your coffee! ☕" << std::endl;
         }
     } else {
         // for normal datasets
-        g_total_nodes = static_cast<unsigned long long>(std::pow(2, n)) * 2;
+        unsigned long long total_nodes = static_cast<unsigned long long>(std::pow(2, n)) * 2;
         
-        ProgressBar progress(g_total_nodes);
-        g_progress = &progress;
+        ProgressBar progress(total_nodes);
+        search.progress = &progress;
         
         knapsackBTRec(
             profits, weights, n,
@@ -122,21 +123,21 @@ BTSol knapsackBT(unsigned int profits[], unsigned int weights[],
             max_weight,
             0, 0, 0,
             curItems,
-            bestSolution
+            bestSolution,
+            search
         );
         
-        if (!g_user_cancelled) {
-            g_progress->complete();
+        if (!search.stopped) {
+            progress.complete();
         }
     }
     
-    if (g_user_cancelled) {
+    if (search.user_cancelled) {
         std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
-        
+    }
+    if (search.stopped) {
         bestSolution = {0, 0, 0, std::vector<bool>(n, false)};
     }
     
-    g_progress = nullptr;
-    
     return bestSolution;
 }
\ No newline at end of file
@@ -5,8 +5,11 @@
 
 #ifndef BACKTRACKING_H
 #define BACKTRACKING_H
+#include <stop_token>
 #include <vector>
 
+class ProgressBar;
+
 /**
  * @brief Structure to hold pallet loading solution for backtracking approach
  * @var BTSol::total_profit Total profit of selected pallets
@@ -22,6 +25,25 @@ struct BTSol
     std::vector<bool> used_pallets;
 };
 
+/**
+ * @brief State of one backtracking search, shared by every level of the recursion
+ * @var BTSearch::nodes_visited Number of nodes visited so far
+ * @var BTSearch::progress Progress bar updated every 10000 nodes (nullptr for none)
+ * @var BTSearch::max_pallets Maximum number of pallets on the truck (0 for no limit)
+ * @var BTSearch::stop Stop source the search gives up on; Esc requests a stop on it too
+ * @var BTSearch::stopped Whether the search gave up (checked at every node)
+ * @var BTSearch::user_cancelled Whether it gave up because Esc was pressed
+ */
+struct BTSearch
+{
+    unsigned long long nodes_visited;
+    ProgressBar *progress;
+    unsigned int max_pallets;
+    std::stop_source stop;
+    bool stopped;
+    bool user_cancelled;
+};
+
 /**
  * @brief Helper function for backtracking algorithm
  * @param profits Array of profit values for each pallet
@@ -34,14 +56,15 @@ struct BTSol
  * @param curCount Current count of pallets
  * @param curItems Current selection of pallets
  * @param bestSolution Reference to the best solution found
+ * @param search State of the search (progress, pallet limit, cancellation)
  * @note Time Complexity: O(2^n) worst case, but typically better than exhaustive search due to pruning
  * @note Space Complexity: O(n) for recursion stack and storing the solution
  */
-void knapsackBTRec(unsigned int profits[], unsigned int weights[],
+void knapsackBTRec(const unsigned int profits[], const unsigned int weights[],
                    unsigned int n, unsigned int curIndex,
                    unsigned int max_weight, unsigned int curWeight,
                    unsigned int curProfit, unsigned int curCount,
-                   std::vector<bool> &curItems, BTSol &bestSolution);
+                   std::vector<bool> &curItems, BTSol &bestSolution, BTSearch &search);
 
 /**
  * @brief Backtracking pallet loading algorithm
@@ -49,11 +72,15 @@ void knapsackBTRec(unsigned int profits[], unsigned int weights[],
  * @param weights Array of weight values for each pallet
  * @param n Number of pallets
  * @param max_weight Maximum weight capacity of truck
- * @return BTSol containing optimal loading
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit)
+ * @param stop Stop source shared with other threads; the search gives up once a stop is requested
+ *             and requests one itself when Esc is pressed
+ * @return BTSol containing optimal loading, or an empty loading when stopped
  * @note Time Complexity: O(2^n) worst case, but typically better than exhaustive search due to pruning
  * @note Space Complexity: O(n) for recursion stack and storing the solution
  */
-BTSol knapsackBT(unsigned int profits[], unsigned int weights[],
-                 unsigned int n, unsigned int max_weight);
+BTSol knapsackBT(const unsigned int profits[], const unsigned int weights[],
+                 unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0,
+                 std::stop_source stop = std::stop_source(std::nostopstate));
 
 #endif // BACKTRACKING_H
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "CapacitySweep.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+CapacitySweep::CapacitySweep(const InstanceView &instance, unsigned int maxCapacity) : dp(maxCapacity)
+{
+    for (unsigned int i = 0; i < instance.n; i++)
+        dp.addPallet(instance.pallets[i], instance.weights[i], instance.profits[i]);
+}
+
+unsigned int CapacitySweep::profitAt(unsigned int capacity) const
+{
+    return dp.bestProfitAt(std::min(capacity, maxCapacity()));
+}
+
+OnlineSol CapacitySweep::solutionAt(unsigned int capacity) const
+{
+    return dp.solutionAt(std::min(capacity, maxCapacity()));
+}
+
+std::vector<unsigned int> CapacitySweep::profitsAt(const std::vector<unsigned int> &capacities) const
+{
+    std::vector<unsigned int> result;
+    result.reserve(capacities.size());
+    for (unsigned int capacity : capacities)
+        result.push_back(profitAt(capacity));
+    return result;
+}
+
+bool CapacitySweep::exportCurveCsv(const std::string &filename) const
+{
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open file: " << filename << std::endl;
+        return false;
+    }
+
+    file << "Capacity,Profit\n";
+    const std::vector<unsigned int> &curve = dp.profitCurve();
+    for (unsigned int w = 0; w < curve.size(); w++)
+        file << w << ',' << curve[w] << '\n';
+    return static_cast<bool>(file);
+}
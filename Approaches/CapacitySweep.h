@@ -0,0 +1,76 @@
+/**
+ * @file CapacitySweep.h
+ * @brief Optimal profit for every truck size from a single dynamic programming pass
+ */
+
+#ifndef CAPACITYSWEEP_H
+#define CAPACITYSWEEP_H
+
+#include <string>
+#include <vector>
+#include "OnlineKnapsack.h"
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Answers knapsack queries for any capacity up to the largest truck
+ *
+ * The DP row of the 0/1 knapsack over capacities 0..W holds the optimum of every smaller
+ * truck as well, so one pass for the largest capacity answers the whole fleet. The pass
+ * keeps one take bit per pallet and capacity, so the selection for any capacity is
+ * rebuilt on demand. Tie-breaking matches knapsackDP.
+ *
+ * @var CapacitySweep::dp Solver holding the DP row and take bits
+ */
+class CapacitySweep
+{
+private:
+    OnlineKnapsack dp;
+
+public:
+    /**
+     * @brief Solves the instance once for the largest capacity
+     * @param instance Pallets (the instance capacity is ignored)
+     * @param maxCapacity Largest capacity that will be queried
+     * @note Time Complexity: O(n×W)
+     * @note Space Complexity: O(W) integers plus n×W bits
+     */
+    CapacitySweep(const InstanceView &instance, unsigned int maxCapacity);
+
+    /**
+     * @brief Largest capacity that can be queried
+     * @return W
+     */
+    unsigned int maxCapacity() const { return dp.truckCapacity(); }
+
+    /**
+     * @brief Optimal profit for a truck
+     * @param capacity Truck capacity (capped to maxCapacity())
+     * @return The optimal profit
+     * @note Time Complexity: O(1)
+     */
+    unsigned int profitAt(unsigned int capacity) const;
+
+    /**
+     * @brief Optimal selection for a truck
+     * @param capacity Truck capacity (capped to maxCapacity())
+     * @return The optimum, indexed like the instance
+     * @note Time Complexity: O(n)
+     */
+    OnlineSol solutionAt(unsigned int capacity) const;
+
+    /**
+     * @brief Optimal profit for a list of trucks
+     * @param capacities Truck capacities
+     * @return The optimal profit of each capacity, in the same order
+     */
+    std::vector<unsigned int> profitsAt(const std::vector<unsigned int> &capacities) const;
+
+    /**
+     * @brief Writes the whole profit-vs-capacity curve as CSV ("Capacity,Profit", one row per capacity)
+     * @param filename Output path
+     * @return true on success, false if the file could not be written
+     */
+    bool exportCurveCsv(const std::string &filename) const;
+};
+
+#endif // CAPACITYSWEEP_H
@@ -0,0 +1,161 @@
+#include "CoreKnapsack.h"
+#include "DynamicProgramming.h"
+#include "IntegerProgramming.h"
+#include "RadixSort.h"
+#include <algorithm>
+#include <memory>
+
+// relative slack on the fixing test, so that rounding never fixes a pallet that should stay free
+static const long double FIXING_MARGIN = 1e-9L;
+
+CoreReduction reduceToCore(const unsigned int profits[], const unsigned int weights[],
+                           unsigned int n, unsigned int max_weight)
+{
+    CoreReduction reduction = {{}, {}, max_weight, std::vector<bool>(n, false), 0};
+
+    // pallets heavier than the truck are out of every loading; weightless ones are in every
+    // optimal loading, so they are fixed before the ratio order ever sees them
+    std::vector<unsigned int> order;
+    order.reserve(n);
+    unsigned long long weightlessProfit = 0;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (weights[i] == 0)
+        {
+            reduction.fixed_in.push_back(i);
+            reduction.lower_bound[i] = true;
+            weightlessProfit += profits[i];
+        }
+        else if (weights[i] <= max_weight)
+        {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [profits, weights](unsigned int a, unsigned int b)
+    {
+        return ratioBefore(profits[a], weights[a], profits[b], weights[b]);
+    });
+
+    // greedy fill up to the break pallet, on top of the weightless pallets
+    size_t breakPos = 0;
+    unsigned long long fillWeight = 0, fillProfit = weightlessProfit;
+    while (breakPos < order.size() && fillWeight + weights[order[breakPos]] <= max_weight)
+    {
+        fillWeight += weights[order[breakPos]];
+        fillProfit += profits[order[breakPos]];
+        breakPos++;
+    }
+
+    // lower bound: the greedy prefix, then every later pallet that still fits
+    unsigned long long lowerWeight = fillWeight;
+    reduction.lower_profit = fillProfit;
+    for (size_t k = 0; k < order.size(); k++)
+    {
+        unsigned int j = order[k];
+        if (k < breakPos)
+        {
+            reduction.lower_bound[j] = true;
+        }
+        else if (lowerWeight + weights[j] <= max_weight)
+        {
+            reduction.lower_bound[j] = true;
+            lowerWeight += weights[j];
+            reduction.lower_profit += profits[j];
+        }
+    }
+    if (breakPos == order.size())
+    {
+        // everything fits
+        reduction.fixed_in.insert(reduction.fixed_in.end(), order.begin(), order.end());
+        reduction.capacity = max_weight - fillWeight;
+        return reduction;
+    }
+
+    // a pallet whose flipped LP bound cannot beat the lower bound keeps its greedy value
+    unsigned int breakPallet = order[breakPos];
+    long double rate = static_cast<long double>(profits[breakPallet]) / weights[breakPallet];
+    long double lpBound = fillProfit + (max_weight - fillWeight) * rate;
+    long double target = (reduction.lower_profit + 1) * (1 - FIXING_MARGIN);
+    for (size_t k = 0; k < order.size(); k++)
+    {
+        unsigned int j = order[k];
+        if (k == breakPos)
+            continue;
+        long double gap = profits[j] - rate * weights[j];
+        long double flipped = lpBound - (k < breakPos ? gap : -gap);
+        if (flipped >= target)
+        {
+            reduction.core.push_back(j);
+        }
+        else if (k < breakPos)
+        {
+            reduction.fixed_in.push_back(j);
+            reduction.capacity -= weights[j];
+        }
+    }
+    reduction.core.push_back(breakPallet);
+    return reduction;
+}
+
+CoreSol knapsackCore(const unsigned int profits[], const unsigned int weights[],
+                     unsigned int n, unsigned int max_weight)
+{
+    CoreSol solution = {0, 0, 0, std::vector<bool>(n, false), 0};
+    CoreReduction reduction = reduceToCore(profits, weights, n, max_weight);
+    std::vector<bool> &used = solution.used_pallets;
+    const std::vector<unsigned int> &core = reduction.core;
+    solution.core_size = core.size();
+
+    // solve the core exactly on the capacity the fixed pallets leave
+    unsigned int m = core.size();
+    unsigned int capacity = reduction.capacity;
+    std::vector<unsigned int> coreProfits(m), coreWeights(m);
+    for (unsigned int k = 0; k < m; k++)
+    {
+        coreProfits[k] = profits[core[k]];
+        coreWeights[k] = weights[core[k]];
+    }
+    std::unique_ptr<bool[]> coreUsed(new bool[m]());
+    unsigned long long coreProfit = 0;
+    if (m == 0)
+    {
+        // nothing left to decide
+    }
+    else if ((m + 1ull) * (capacity + 1ull) <= CORE_DP_CELL_LIMIT)
+    {
+        coreProfit = knapsackDP(coreProfits.data(), coreWeights.data(), m, capacity, coreUsed.get());
+    }
+    else
+    {
+        ILPSol coreSolution = knapsackBranchAndBound(coreProfits.data(), coreWeights.data(), m, capacity);
+        coreProfit = coreSolution.total_profit;
+        for (unsigned int k = 0; k < m; k++)
+            coreUsed[k] = coreSolution.used_pallets[k];
+    }
+
+    unsigned long long fixedProfit = 0;
+    for (unsigned int j : reduction.fixed_in)
+        fixedProfit += profits[j];
+    if (fixedProfit + coreProfit >= reduction.lower_profit)
+    {
+        for (unsigned int j : reduction.fixed_in)
+            used[j] = true;
+        for (unsigned int k = 0; k < m; k++)
+            used[core[k]] = coreUsed[k];
+    }
+    else
+    {
+        used = reduction.lower_bound;
+    }
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (used[i])
+        {
+            solution.total_profit += profits[i];
+            solution.total_weight += weights[i];
+            solution.pallet_count++;
+        }
+    }
+    return solution;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file CoreKnapsack.h
+ * @brief Header for the core approach for 0/1 Knapsack: variable reduction around the break item
+ */
+
+#ifndef COREKNAPSACK_H
+#define COREKNAPSACK_H
+#include <vector>
+
+/**
+ * @brief Largest (core + 1) × (residual capacity + 1) table the core is solved with dynamic
+ *        programming; larger cores are solved with branch-and-bound
+ */
+const unsigned long long CORE_DP_CELL_LIMIT = 1ull << 25;
+
+/**
+ * @brief Structure to hold pallet loading solution for the core approach
+ * @var CoreSol::total_profit Total profit of selected pallets
+ * @var CoreSol::total_weight Total weight of selected pallets
+ * @var CoreSol::pallet_count Number of pallets selected
+ * @var CoreSol::used_pallets Boolean vector indicating which pallets are used
+ * @var CoreSol::core_size Number of pallets left free by the reduction
+ */
+struct CoreSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+    unsigned int core_size;
+};
+
+/**
+ * @brief Result of the reduction step of the core approach
+ * @var CoreReduction::core Pallets left free, the break pallet last (empty when every pallet fits)
+ * @var CoreReduction::fixed_in Pallets fixed on the truck
+ * @var CoreReduction::capacity Capacity left for the core once the fixed pallets are loaded
+ * @var CoreReduction::lower_bound Greedy loading the core solution has to beat
+ * @var CoreReduction::lower_profit Profit of that loading
+ */
+struct CoreReduction
+{
+    std::vector<unsigned int> core;
+    std::vector<unsigned int> fixed_in;
+    unsigned int capacity;
+    std::vector<bool> lower_bound;
+    unsigned long long lower_profit;
+};
+
+/**
+ * @brief Reduction step of knapsackCore: greedy loading, break pallet and variable fixing
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @return The core, the fixed pallets and the greedy loading
+ * @note Also used by the cost model, which needs the core size before choosing a solver.
+ * @note Time Complexity: O(n log n) for sorting
+ */
+CoreReduction reduceToCore(const unsigned int profits[], const unsigned int weights[],
+                           unsigned int n, unsigned int max_weight);
+
+/**
+ * @brief Core pallet loading algorithm
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @return CoreSol containing an optimal loading
+ * @note Pallets are sorted by profit/weight and filled greedily up to the break pallet b, whose
+ *       ratio r prices the capacity. Flipping pallet j away from its greedy choice costs at least
+ *       |p_j - r × w_j| in the LP bound (Dembo-Hammer); pallets whose flipped bound cannot beat
+ *       the greedy loading are fixed. The remaining core is solved exactly on the capacity left
+ *       (knapsackDP when the table fits CORE_DP_CELL_LIMIT, branch-and-bound otherwise) and the
+ *       better of that and the greedy loading is optimal.
+ * @note Weightless pallets are fixed on the truck before the ratio sort: they cost no capacity,
+ *       and leaving them in the core would put an infinite-ratio pallet in front of the order.
+ * @note On uncorrelated instances the core is a small band around b; when most pallets have
+ *       the same ratio nothing can be fixed and the core is the whole instance.
+ * @note Does not take a pallet limit.
+ * @note Time Complexity: O(n log n) for sorting + the exact solve of the core
+ * @note Space Complexity: O(n) + the exact solve of the core
+ */
+CoreSol knapsackCore(const unsigned int profits[], const unsigned int weights[],
+                     unsigned int n, unsigned int max_weight);
+
+#endif // COREKNAPSACK_H
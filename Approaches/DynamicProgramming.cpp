@@ -1,9 +1,12 @@
 #include "DynamicProgramming.h"
 #include "../Output/ProgressBar.h"
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <iostream>
 
-unsigned int knapsackDP(unsigned int profits[], unsigned int weights[], unsigned int n, unsigned int capacity, bool usedItems[])
+unsigned int knapsackDP(const unsigned int profits[], const unsigned int weights[], unsigned int n, unsigned int capacity, bool usedItems[],
+                        std::stop_source stop)
 {
     std::vector<std::vector<unsigned int>> table(n + 1, std::vector<unsigned int>(capacity + 1, 0));
 
@@ -13,27 +16,29 @@ unsigned int knapsackDP(unsigned int profits[], unsigned int weights[], unsigned
     // stores a score based on indices of pallets used 
     std::vector<std::vector<unsigned int>> indexSumTable(n + 1, std::vector<unsigned int>(capacity + 1, 0));
 
-    unsigned long long total_operations = (unsigned long long)(n)*capacity;
+    unsigned long long total_operations = (unsigned long long)(n)*(capacity + 1);
     ProgressBar progress(total_operations);
     unsigned long long current_operation = 0;
     bool user_cancelled = false;
+    bool stopped = false;
 
-    for (unsigned int i = 1; i <= n && !user_cancelled; i++)
+    for (unsigned int i = 1; i <= n && !stopped; i++)
     {
-        for (unsigned int w = 1; w <= capacity && !user_cancelled; w++)
+        // column 0 too: weightless pallets still add profit at zero capacity
+        for (unsigned int w = 0; w <= capacity && !stopped; w++)
         {
             current_operation++;
 
             if (current_operation % 10000 == 0)
             {
-                if (progress.shouldShow())
+                if (progress.shouldShow() && !progress.update(current_operation))
                 {
-                    if (!progress.update(current_operation))
-                    {
-                        user_cancelled = true;
-                        break;
-                    }
+                    user_cancelled = true;
+                    stop.request_stop();
                 }
+                stopped = user_cancelled || stop.stop_requested();
+                if (stopped)
+                    break;
             }
 
             if (weights[i - 1] > w)
@@ -99,14 +104,15 @@ unsigned int knapsackDP(unsigned int profits[], unsigned int weights[], unsigned
         }
     }
 
-    if (!user_cancelled)
+    if (!stopped)
     {
         progress.complete();
     }
 
-    if (user_cancelled)
+    if (stopped)
     {
-        std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
+        if (user_cancelled)
+            std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
 
         for (unsigned int i = 0; i < n; i++)
         {
@@ -150,4 +156,124 @@ unsigned int knapsackDP(unsigned int profits[], unsigned int weights[], unsigned
     }
 
     return table[n][capacity];
-}
\ No newline at end of file
+}
+
+// pallets that fit on their own, and the effective limit and capacity of the cardinality table
+static void cardinalityDimensions(const unsigned int weights[], unsigned int n, unsigned int capacity,
+                                  unsigned int maxPallets, std::vector<unsigned int> &fitting,
+                                  unsigned int &limit, unsigned int &maxWeight)
+{
+    unsigned long long totalWeight = 0;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (weights[i] <= capacity)
+        {
+            fitting.push_back(i);
+            totalWeight += weights[i];
+        }
+    }
+    limit = maxPallets == 0 ? fitting.size() : std::min<unsigned int>(maxPallets, fitting.size());
+    maxWeight = std::min<unsigned long long>(capacity, totalWeight);
+}
+
+bool knapsackDPCardinalityFits(const unsigned int weights[], unsigned int n, unsigned int capacity,
+                               unsigned int maxPallets)
+{
+    std::vector<unsigned int> fitting;
+    unsigned int limit, maxWeight;
+    cardinalityDimensions(weights, n, capacity, maxPallets, fitting, limit, maxWeight);
+    return static_cast<unsigned long long>(fitting.size()) * (limit + 1) * (maxWeight + 1ull) <=
+           CARDINALITY_DP_BIT_LIMIT;
+}
+
+unsigned int knapsackDPCardinality(const unsigned int profits[], const unsigned int weights[], unsigned int n,
+                                   unsigned int capacity, unsigned int maxPallets, bool usedItems[],
+                                   std::stop_source stop)
+{
+    for (unsigned int i = 0; i < n; i++)
+    {
+        usedItems[i] = false;
+    }
+
+    std::vector<unsigned int> fitting;
+    unsigned int limit, maxWeight;
+    cardinalityDimensions(weights, n, capacity, maxPallets, fitting, limit, maxWeight);
+
+    // cell (k, w): best loading with at most k pallets and at most w weight
+    size_t rowCells = maxWeight + 1;
+    size_t cells = (limit + 1) * rowCells;
+    size_t rowWords = (cells + 63) / 64;
+    std::vector<unsigned int> table(cells, 0);
+    std::vector<unsigned int> countTable(cells, 0);
+    std::vector<unsigned long long> indexSumTable(cells, 0);
+    std::vector<uint64_t> takeBits(fitting.size() * rowWords, 0);
+
+    ProgressBar progress(fitting.size());
+    bool user_cancelled = false;
+    bool stopped = false;
+
+    for (unsigned int item = 0; item < fitting.size(); item++)
+    {
+        if (progress.shouldShow() && !progress.update(item))
+        {
+            user_cancelled = true;
+            stop.request_stop();
+        }
+        stopped = user_cancelled || stop.stop_requested();
+        if (stopped)
+            break;
+
+        unsigned int i = fitting[item];
+        uint64_t *bits = takeBits.data() + item * rowWords;
+
+        // counts and weights descending: cell (k - 1, w - weight) still holds the layer before this pallet
+        for (unsigned int k = limit; k >= 1; k--)
+        {
+            size_t row = k * rowCells;
+            for (unsigned int w = maxWeight; w >= weights[i]; w--)
+            {
+                size_t cell = row + w;
+                size_t from = cell - rowCells - weights[i];
+                unsigned int valueWithItem = table[from] + profits[i];
+                unsigned int countWithItem = countTable[from] + 1;
+                unsigned long long indexSumWithItem = indexSumTable[from] + i;
+
+                if (valueWithItem > table[cell] ||
+                    (valueWithItem == table[cell] &&
+                     (countWithItem < countTable[cell] ||
+                      (countWithItem == countTable[cell] && indexSumWithItem < indexSumTable[cell]))))
+                {
+                    table[cell] = valueWithItem;
+                    countTable[cell] = countWithItem;
+                    indexSumTable[cell] = indexSumWithItem;
+                    bits[cell / 64] |= uint64_t(1) << (cell % 64);
+                }
+
+                if (w == 0)
+                    break;
+            }
+        }
+    }
+
+    if (stopped)
+    {
+        if (user_cancelled)
+            std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
+        return 0;
+    }
+    progress.complete();
+
+    // walk the pallets backwards, following the take bit at the remaining (count, weight)
+    size_t cell = cells - 1;
+    for (size_t item = fitting.size(); item-- > 0;)
+    {
+        if (takeBits[item * rowWords + cell / 64] >> (cell % 64) & 1)
+        {
+            unsigned int i = fitting[item];
+            usedItems[i] = true;
+            cell -= rowCells + weights[i];
+        }
+    }
+
+    return table[cells - 1];
+}
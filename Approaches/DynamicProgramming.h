@@ -7,6 +7,13 @@
 #define DYNAMICPROGRAMMING_H
 
 #include <iostream>
+#include <stop_token>
+
+/**
+ * @brief Largest pallets × (limit + 1) × (capacity + 1) product for knapsackDPCardinality
+ *        (one take bit per pallet and cell, 512 MiB at most)
+ */
+const unsigned long long CARDINALITY_DP_BIT_LIMIT = 1ull << 32;
 
 /**
  * @brief Dynamic programming solution for the 0/1 Knapsack problem
@@ -15,13 +22,49 @@
  * @param n Number of pallets
  * @param capacity Maximum weight capacity of the truck
  * @param usedItems Output array that will indicate which pallets were selected
- * @return The maximum total profit achievable
+ * @param stop Stop source shared with other threads; the table is abandoned once a stop is
+ *             requested, and Esc requests one
+ * @return The maximum total profit achievable (0 with nothing selected when stopped)
  * @note When multiple solutions have the same profit, solutions with fewer
  *       pallets are preferred. If pallet counts are equal, solutions with
  *       pallets having lower indices are prioritized.
  * @note Time Complexity: O(n×W) where n is the number of pallets and W is the truck capacity
  * @note Space Complexity: O(n×W) for the DP table
  */
-unsigned int knapsackDP(unsigned int profits[], unsigned int weights[], unsigned int n, unsigned int capacity, bool usedItems[]);
+unsigned int knapsackDP(const unsigned int profits[], const unsigned int weights[], unsigned int n, unsigned int capacity, bool usedItems[],
+                        std::stop_source stop = std::stop_source(std::nostopstate));
+
+/**
+ * @brief Checks whether knapsackDPCardinality fits within CARDINALITY_DP_BIT_LIMIT
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param capacity Maximum weight capacity of the truck
+ * @param maxPallets Maximum number of pallets on the truck
+ * @return true if the cardinality DP can be used on this instance
+ */
+bool knapsackDPCardinalityFits(const unsigned int weights[], unsigned int n, unsigned int capacity,
+                               unsigned int maxPallets);
+
+/**
+ * @brief Dynamic programming for the 0/1 Knapsack with at most maxPallets pallets
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param capacity Maximum weight capacity of the truck
+ * @param maxPallets Maximum number of pallets on the truck (0 for no limit)
+ * @param usedItems Output array that will indicate which pallets were selected
+ * @param stop Stop source shared with other threads, as in knapsackDP
+ * @return The maximum total profit achievable with at most maxPallets pallets (0 when stopped)
+ * @note The pallet count is an extra table dimension. Only one (count, weight) layer is kept
+ *       and updated in place, with counts and weights descending; the selection is rebuilt from
+ *       one take bit per pallet and cell. Pallets heavier than the truck get no bits, the count
+ *       dimension is cut to the number of pallets and the weight one to their total weight.
+ * @note Same tie-break as knapsackDP: on equal profit, fewer pallets, then lower indices.
+ * @note Time Complexity: O(n×K×W) for the limit K
+ * @note Space Complexity: O(K×W) for the layer + O(n×K×W) bits
+ */
+unsigned int knapsackDPCardinality(const unsigned int profits[], const unsigned int weights[], unsigned int n,
+                                   unsigned int capacity, unsigned int maxPallets, bool usedItems[],
+                                   std::stop_source stop = std::stop_source(std::nostopstate));
 
 #endif // DYNAMICPROGRAMMING_H
\ No newline at end of file
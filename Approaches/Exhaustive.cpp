@@ -7,8 +7,8 @@
 #include <iostream>
 
 
-BFSol knapsackBF(unsigned int profits[], unsigned int weights[],
-                 unsigned int n, unsigned int max_weight)
+BFSol knapsackBF(const unsigned int profits[], const unsigned int weights[],
+                 unsigned int n, unsigned int max_weight, unsigned int max_pallets)
 {
     BFSol best_solution = {0, 0, 0, std::vector<bool>(n, false)};
     std::vector<bool> current(n, false);
@@ -52,7 +52,7 @@ BFSol knapsackBF(unsigned int profits[], unsigned int weights[],
             }
         }
 
-        if (current_weight <= max_weight)
+        if (current_weight <= max_weight && (max_pallets == 0 || current_count <= max_pallets))
         {
             bool is_better = false;
 
@@ -28,6 +28,7 @@ struct BFSol
  * @param weights Array of weight values for each pallet
  * @param n Number of pallets
  * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit)
  * @return BFSol containing optimal loading
  * @note When multiple solutions have the same profit, solutions with fewer
  *       pallets are preferred. If pallet counts are equal, solutions with
@@ -35,7 +36,7 @@ struct BFSol
  * @note Time Complexity: O(2^n) where n is the number of pallets
  * @note Space Complexity: O(n) for storing the solution
  */
-BFSol knapsackBF(unsigned int profits[], unsigned int weights[],
-                 unsigned int n, unsigned int max_weight);
+BFSol knapsackBF(const unsigned int profits[], const unsigned int weights[],
+                 unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0);
 
 #endif // EXHAUSTIVE_H
\ No newline at end of file
@@ -1,13 +1,15 @@
 #include "Greedy.h"
+#include "RadixSort.h"
 #include "../Output/ProgressBar.h"
 #include <vector>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <utility>
 
 
-GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
-                              unsigned int n, unsigned int max_weight)
+GreedySol knapsackGreedyRatio(const unsigned int profits[], const unsigned int weights[],
+                              unsigned int n, unsigned int max_weight, unsigned int max_pallets)
 {
     GreedySol solution;
     solution.total_profit = 0;
@@ -16,30 +18,56 @@ GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
     solution.used_pallets.resize(n, false);
     solution.approach_name = "Weight-to-Profit Ratio";
 
-    std::vector<std::pair<unsigned int, double>> items(n);
-    for (unsigned int i = 0; i < n; i++)
+    std::vector<unsigned int> order;
+    if (n >= RADIX_SORT_THRESHOLD)
     {
-        if (weights[i] == 0)
+        // large manifests: radix sort on fixed-point ratio keys (stable, so lower indices win ties)
+        std::vector<unsigned long long> keys(n);
+        for (unsigned int i = 0; i < n; i++)
         {
-            items[i] = std::make_pair(i, std::numeric_limits<double>::max());
+            keys[i] = ratioKey(profits[i], weights[i]);
+        }
+        order = radixSortDescending(keys.data(), n);
+    }
+    else
+    {
+        std::vector<std::pair<unsigned int, double>> items(n);
+        for (unsigned int i = 0; i < n; i++)
+        {
+            if (weights[i] == 0)
+            {
+                items[i] = std::make_pair(i, std::numeric_limits<double>::max());
+            }
+            else
+            {
+                double ratio = static_cast<double>(profits[i]) / weights[i];
+                items[i] = std::make_pair(i, ratio);
+            }
         }
-        else
+
+        // sort items by profit/weight ratio in descending order
+        // if ratios are equal, prioritize lower indices
+        std::sort(items.begin(), items.end(),
+                  [](const std::pair<unsigned int, double> &a,
+                     const std::pair<unsigned int, double> &b)
+                  {
+                      if (a.second != b.second)
+                          return a.second > b.second;
+                      return a.first < b.first;
+                  });
+
+        order.resize(n);
+        for (unsigned int i = 0; i < n; i++)
         {
-            double ratio = static_cast<double>(profits[i]) / weights[i];
-            items[i] = std::make_pair(i, ratio);
+            order[i] = items[i].first;
         }
     }
 
-    // sort items by profit/weight ratio in descending order
-    // if ratios are equal, prioritize lower indices
-    std::sort(items.begin(), items.end(),
-              [](const std::pair<unsigned int, double> &a,
-                 const std::pair<unsigned int, double> &b)
-              {
-                  if (a.second != b.second)
-                      return a.second > b.second;
-                  return a.first < b.first;
-              });
+    // weightless pallets lead both orders; sort them by falling profit so the best take the slots
+    auto weightlessEnd = std::find_if(order.begin(), order.end(),
+                                      [&](unsigned int i) { return weights[i] != 0; });
+    std::stable_sort(order.begin(), weightlessEnd,
+                     [&](unsigned int a, unsigned int b) { return profits[a] > profits[b]; });
 
     ProgressBar progress(n);
     bool user_cancelled = false;
@@ -55,7 +83,19 @@ GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
             }
         }
 
-        unsigned int idx = items[i].first;
+        // every slot on the truck is taken
+        if (max_pallets != 0 && solution.pallet_count == max_pallets)
+        {
+            break;
+        }
+
+        unsigned int idx = order[i];
+
+        // a worthless pallet would only use up one of the limited slots
+        if (max_pallets != 0 && profits[idx] == 0)
+        {
+            continue;
+        }
 
         if (solution.total_weight + weights[idx] <= max_weight)
         {
@@ -81,8 +121,8 @@ GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
     return solution;
 }
 
-GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
-                               unsigned int n, unsigned int max_weight)
+GreedySol knapsackGreedyProfit(const unsigned int profits[], const unsigned int weights[],
+                               unsigned int n, unsigned int max_weight, unsigned int max_pallets)
 {
     GreedySol solution;
     solution.total_profit = 0;
@@ -91,22 +131,37 @@ GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
     solution.used_pallets.resize(n, false);
     solution.approach_name = "Biggest Profit Values";
 
-    std::vector<std::pair<unsigned int, unsigned int>> items(n);
-    for (unsigned int i = 0; i < n; i++)
+    std::vector<unsigned int> order;
+    if (n >= RADIX_SORT_THRESHOLD)
     {
-        items[i] = std::make_pair(i, profits[i]);
+        // large manifests: radix sort on the profit keys (stable, so lower indices win ties)
+        order = radixSortDescending(profits, n);
     }
+    else
+    {
+        std::vector<std::pair<unsigned int, unsigned int>> items(n);
+        for (unsigned int i = 0; i < n; i++)
+        {
+            items[i] = std::make_pair(i, profits[i]);
+        }
 
-    // sort items by profit value in descending order
-    // if profits are equal, prioritize lower indices (tiebreaker)
-    std::sort(items.begin(), items.end(),
-              [](const std::pair<unsigned int, unsigned int> &a,
-                 const std::pair<unsigned int, unsigned int> &b)
-              {
-                  if (a.second != b.second)
-                      return a.second > b.second;
-                  return a.first < b.first;
-              });
+        // sort items by profit value in descending order
+        // if profits are equal, prioritize lower indices (tiebreaker)
+        std::sort(items.begin(), items.end(),
+                  [](const std::pair<unsigned int, unsigned int> &a,
+                     const std::pair<unsigned int, unsigned int> &b)
+                  {
+                      if (a.second != b.second)
+                          return a.second > b.second;
+                      return a.first < b.first;
+                  });
+
+        order.resize(n);
+        for (unsigned int i = 0; i < n; i++)
+        {
+            order[i] = items[i].first;
+        }
+    }
 
     ProgressBar progress(n);
     bool user_cancelled = false;
@@ -122,7 +177,13 @@ GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
             }
         }
 
-        unsigned int idx = items[i].first;
+        // every slot on the truck is taken
+        if (max_pallets != 0 && solution.pallet_count == max_pallets)
+        {
+            break;
+        }
+
+        unsigned int idx = order[i];
 
         if (solution.total_weight + weights[idx] <= max_weight)
         {
@@ -148,12 +209,12 @@ GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
     return solution;
 }
 
-GreedySol knapsackGreedyMaximum(unsigned int profits[], unsigned int weights[],
-                                unsigned int n, unsigned int max_weight)
+GreedySol knapsackGreedyMaximum(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, unsigned int max_weight, unsigned int max_pallets)
 {
-    GreedySol ratio_solution = knapsackGreedyRatio(profits, weights, n, max_weight);
+    GreedySol ratio_solution = knapsackGreedyRatio(profits, weights, n, max_weight, max_pallets);
 
-    GreedySol profit_solution = knapsackGreedyProfit(profits, weights, n, max_weight);
+    GreedySol profit_solution = knapsackGreedyProfit(profits, weights, n, max_weight, max_pallets);
 
     if (ratio_solution.total_profit > profit_solution.total_profit)
     {
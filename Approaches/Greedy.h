@@ -31,12 +31,15 @@ struct GreedySol
  * @param weights Array of weight values for each pallet
  * @param n Number of pallets
  * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit); selection stops once it is reached
  * @return GreedySol containing the solution
- * @note Time Complexity: O(n log n) for sorting + O(n) for selection = O(n log n)
+ * @note Weightless pallets go first, by falling profit; with a pallet limit, worthless pallets are skipped.
+ * @note Time Complexity: O(n log n) for sorting + O(n) for selection = O(n log n);
+ *       from RADIX_SORT_THRESHOLD pallets on, a radix sort on fixed-point ratios makes it O(n)
  * @note Space Complexity: O(n) for storing the ratios and solution
  */
-GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
-                              unsigned int n, unsigned int max_weight);
+GreedySol knapsackGreedyRatio(const unsigned int profits[], const unsigned int weights[],
+                              unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0);
 
 /**
  * @brief Greedy approximation using profit values
@@ -44,12 +47,14 @@ GreedySol knapsackGreedyRatio(unsigned int profits[], unsigned int weights[],
  * @param weights Array of weight values for each pallet
  * @param n Number of pallets
  * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit); selection stops once it is reached
  * @return GreedySol containing the solution
- * @note Time Complexity: O(n log n) for sorting + O(n) for selection = O(n log n)
+ * @note Time Complexity: O(n log n) for sorting + O(n) for selection = O(n log n);
+ *       from RADIX_SORT_THRESHOLD pallets on, a radix sort on the profits makes it O(n)
  * @note Space Complexity: O(n) for storing pairs and solution
  */
-GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
-                               unsigned int n, unsigned int max_weight);
+GreedySol knapsackGreedyProfit(const unsigned int profits[], const unsigned int weights[],
+                               unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0);
 
 /**
  * @brief Runs both greedy approximations and returns the better solution
@@ -57,6 +62,7 @@ GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
  * @param weights Array of weight values for each pallet
  * @param n Number of pallets
  * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit)
  * @return GreedySol containing the better solution
  * @note When comparing solutions, the function prioritizes higher total profit.
  *       If profits are equal, it selects the solution with fewer pallets.
@@ -64,7 +70,7 @@ GreedySol knapsackGreedyProfit(unsigned int profits[], unsigned int weights[],
  * @note Time Complexity: O(n log n) for each greedy approach = O(n log n)
  * @note Space Complexity: O(n) for storing solutions
  */
-GreedySol knapsackGreedyMaximum(unsigned int profits[], unsigned int weights[],
-                                unsigned int n, unsigned int max_weight);
+GreedySol knapsackGreedyMaximum(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0);
 
 #endif // GREEDY_H
\ No newline at end of file
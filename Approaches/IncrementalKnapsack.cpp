@@ -0,0 +1,232 @@
+#include "IncrementalKnapsack.h"
+#include <algorithm>
+#include <limits>
+
+// capacity times the headroom factor, kept small enough for the row stride maxCapacity + 1
+static unsigned int withHeadroom(unsigned int capacity)
+{
+    unsigned long long grown = static_cast<unsigned long long>(capacity) * INCREMENTAL_CAPACITY_HEADROOM;
+    return static_cast<unsigned int>(
+        std::min<unsigned long long>(grown, std::numeric_limits<unsigned int>::max() - 1));
+}
+
+IncrementalKnapsack::IncrementalKnapsack(const InstanceView &instance, unsigned int maxCapacity)
+    : capacity(instance.capacity), maxCapacity(std::max(maxCapacity, instance.capacity))
+{
+    frontProfit.assign(this->maxCapacity + 1, 0);
+    frontCount.assign(this->maxCapacity + 1, 0);
+    backProfit.assign(this->maxCapacity + 1, 0);
+    backCount.assign(this->maxCapacity + 1, 0);
+
+    front.reserve(instance.n);
+    frontProfit.reserve(static_cast<size_t>(instance.n + 1) * (this->maxCapacity + 1));
+    frontCount.reserve(static_cast<size_t>(instance.n + 1) * (this->maxCapacity + 1));
+    for (unsigned int i = 0; i < instance.n; i++)
+        addPallet(instance.pallets[i], instance.weights[i], instance.profits[i]);
+}
+
+void IncrementalKnapsack::pushRow(std::vector<unsigned int> &profitRows, std::vector<unsigned int> &countRows,
+                                  const Pallet &pallet)
+{
+    size_t stride = static_cast<size_t>(maxCapacity) + 1;
+    size_t previous = profitRows.size() - stride;
+    size_t current = profitRows.size();
+    profitRows.resize(current + stride);
+    countRows.resize(current + stride);
+
+    for (unsigned int w = 0; w <= maxCapacity; w++)
+    {
+        unsigned int profit = profitRows[previous + w];
+        unsigned int count = countRows[previous + w];
+        if (pallet.weight <= w)
+        {
+            unsigned int profitWithPallet = profitRows[previous + w - pallet.weight] + pallet.profit;
+            unsigned int countWithPallet = countRows[previous + w - pallet.weight] + 1;
+            if (profitWithPallet > profit || (profitWithPallet == profit && countWithPallet < count))
+            {
+                profit = profitWithPallet;
+                count = countWithPallet;
+            }
+        }
+        profitRows[current + w] = profit;
+        countRows[current + w] = count;
+    }
+}
+
+void IncrementalKnapsack::popRow(std::vector<unsigned int> &profitRows, std::vector<unsigned int> &countRows)
+{
+    size_t stride = static_cast<size_t>(maxCapacity) + 1;
+    profitRows.resize(profitRows.size() - stride);
+    countRows.resize(countRows.size() - stride);
+}
+
+void IncrementalKnapsack::moveGapLeft()
+{
+    Pallet pallet = front.back();
+    front.pop_back();
+    popRow(frontProfit, frontCount);
+    back.push_back(pallet);
+    pushRow(backProfit, backCount, pallet);
+}
+
+void IncrementalKnapsack::moveGapRight()
+{
+    Pallet pallet = back.back();
+    back.pop_back();
+    popRow(backProfit, backCount);
+    front.push_back(pallet);
+    pushRow(frontProfit, frontCount, pallet);
+}
+
+void IncrementalKnapsack::addPallet(unsigned int id, unsigned int weight, unsigned int profit)
+{
+    Pallet pallet = {id, weight, profit};
+    front.push_back(pallet);
+    pushRow(frontProfit, frontCount, pallet);
+}
+
+bool IncrementalKnapsack::removePallet(unsigned int id)
+{
+    // distance from the gap of the nearest match on each side
+    size_t frontDistance = front.size(), backDistance = back.size();
+    for (size_t d = 0; d < front.size(); d++)
+    {
+        if (front[front.size() - 1 - d].id == id)
+        {
+            frontDistance = d;
+            break;
+        }
+    }
+    for (size_t d = 0; d < back.size(); d++)
+    {
+        if (back[back.size() - 1 - d].id == id)
+        {
+            backDistance = d;
+            break;
+        }
+    }
+
+    bool inFront = frontDistance < front.size();
+    bool inBack = backDistance < back.size();
+    if (!inFront && !inBack)
+        return false;
+
+    if (inFront && (!inBack || frontDistance <= backDistance))
+    {
+        for (size_t d = 0; d < frontDistance; d++)
+            moveGapLeft();
+        front.pop_back();
+        popRow(frontProfit, frontCount);
+    }
+    else
+    {
+        for (size_t d = 0; d < backDistance; d++)
+            moveGapRight();
+        back.pop_back();
+        popRow(backProfit, backCount);
+    }
+    return true;
+}
+
+void IncrementalKnapsack::changeCapacity(unsigned int newCapacity)
+{
+    if (newCapacity <= maxCapacity)
+    {
+        capacity = newCapacity;
+        return;
+    }
+
+    // the rows stop at maxCapacity: rebuild them with room to grow, so that raise after raise
+    // does not rebuild every time
+    Instance pallets = manifest();
+    pallets.capacity = newCapacity;
+    *this = IncrementalKnapsack(pallets.view(), std::max(newCapacity, withHeadroom(maxCapacity)));
+}
+
+unsigned int IncrementalKnapsack::bestSplit() const
+{
+    size_t stride = static_cast<size_t>(maxCapacity) + 1;
+    const unsigned int *frontProfitRow = frontProfit.data() + front.size() * stride;
+    const unsigned int *frontCountRow = frontCount.data() + front.size() * stride;
+    const unsigned int *backProfitRow = backProfit.data() + back.size() * stride;
+    const unsigned int *backCountRow = backCount.data() + back.size() * stride;
+
+    // capacity w for the pallets before the gap, the rest for the ones after it
+    unsigned int bestW = 0;
+    unsigned int bestProfitValue = frontProfitRow[0] + backProfitRow[capacity];
+    unsigned int bestCount = frontCountRow[0] + backCountRow[capacity];
+    for (unsigned int w = 1; w <= capacity; w++)
+    {
+        unsigned int profit = frontProfitRow[w] + backProfitRow[capacity - w];
+        unsigned int count = frontCountRow[w] + backCountRow[capacity - w];
+        if (profit > bestProfitValue || (profit == bestProfitValue && count < bestCount))
+        {
+            bestW = w;
+            bestProfitValue = profit;
+            bestCount = count;
+        }
+    }
+    return bestW;
+}
+
+unsigned int IncrementalKnapsack::bestProfit() const
+{
+    size_t stride = static_cast<size_t>(maxCapacity) + 1;
+    unsigned int w = bestSplit();
+    return frontProfit[front.size() * stride + w] + backProfit[back.size() * stride + capacity - w];
+}
+
+IncrementalSol IncrementalKnapsack::solution() const
+{
+    size_t stride = static_cast<size_t>(maxCapacity) + 1;
+    IncrementalSol result;
+    result.total_profit = 0;
+    result.total_weight = 0;
+    result.pallet_count = 0;
+    result.used_pallets.assign(size(), false);
+
+    unsigned int split = bestSplit();
+
+    // a pallet was taken where its row differs from the row before it
+    unsigned int w = split;
+    for (size_t i = front.size(); i > 0; i--)
+    {
+        size_t row = i * stride, previous = (i - 1) * stride;
+        if (frontProfit[row + w] != frontProfit[previous + w] || frontCount[row + w] != frontCount[previous + w])
+        {
+            result.used_pallets[i - 1] = true;
+            result.total_profit += front[i - 1].profit;
+            result.total_weight += front[i - 1].weight;
+            result.pallet_count++;
+            w -= front[i - 1].weight;
+        }
+    }
+
+    w = capacity - split;
+    for (size_t j = back.size(); j > 0; j--)
+    {
+        size_t row = j * stride, previous = (j - 1) * stride;
+        if (backProfit[row + w] != backProfit[previous + w] || backCount[row + w] != backCount[previous + w])
+        {
+            // back[j - 1] sits at this position of the manifest
+            result.used_pallets[front.size() + back.size() - j] = true;
+            result.total_profit += back[j - 1].profit;
+            result.total_weight += back[j - 1].weight;
+            result.pallet_count++;
+            w -= back[j - 1].weight;
+        }
+    }
+    return result;
+}
+
+Instance IncrementalKnapsack::manifest() const
+{
+    Instance result;
+    result.capacity = capacity;
+    result.reserve(size());
+    for (const Pallet &pallet : front)
+        result.push_back(pallet.id, pallet.weight, pallet.profit);
+    for (size_t j = back.size(); j > 0; j--)
+        result.push_back(back[j - 1].id, back[j - 1].weight, back[j - 1].profit);
+    return result;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file IncrementalKnapsack.h
+ * @brief Dynamic programming that is kept up to date while pallets are added or removed
+ */
+
+#ifndef INCREMENTALKNAPSACK_H
+#define INCREMENTALKNAPSACK_H
+
+#include <vector>
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Factor by which the rows' capacity range exceeds the truck capacity, and grows on a rebuild
+ */
+const unsigned int INCREMENTAL_CAPACITY_HEADROOM = 2;
+
+/**
+ * @brief Structure to hold the optimum of the incremental solver
+ * @var IncrementalSol::total_profit Total profit of selected pallets
+ * @var IncrementalSol::total_weight Total weight of selected pallets
+ * @var IncrementalSol::pallet_count Number of pallets selected
+ * @var IncrementalSol::used_pallets Which pallets are used, in the order of IncrementalKnapsack::manifest()
+ */
+struct IncrementalSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+};
+
+/**
+ * @brief 0/1 knapsack over an editable manifest, with forward and backward DP tables
+ *
+ * The manifest is a gap buffer: the pallets before the gap have forward (prefix) DP rows and
+ * the pallets after it have backward (suffix) DP rows, each row computed from its neighbour
+ * towards the ends. An edit at the gap adds or drops a single row, so it costs O(W); the
+ * optimum joins the two rows next to the gap in O(W). Removing a pallet away from the gap
+ * first moves the gap to it, one O(W) row per pallet crossed, so a remove costs
+ * O(W × distance) and a remove at the far end of the manifest O(n×W).
+ *
+ * Rows hold the best profit for every capacity up to the maximum capacity given at
+ * construction, so lowering the capacity (or raising it up to that maximum) needs no
+ * recomputation. A raise beyond it rebuilds the rows for at least INCREMENTAL_CAPACITY_HEADROOM
+ * times the old maximum, so a series of raises triggers only a logarithmic number of rebuilds.
+ * On equal profit, fewer pallets are preferred.
+ *
+ * @var IncrementalKnapsack::capacity Current truck capacity
+ * @var IncrementalKnapsack::maxCapacity Largest capacity the rows are computed for
+ * @var IncrementalKnapsack::front Pallets before the gap, in manifest order
+ * @var IncrementalKnapsack::back Pallets after the gap, the one next to the gap last
+ * @var IncrementalKnapsack::frontProfit Forward rows (front.size() + 1 rows of maxCapacity + 1)
+ * @var IncrementalKnapsack::frontCount Pallet counts of the forward rows
+ * @var IncrementalKnapsack::backProfit Backward rows (back.size() + 1 rows of maxCapacity + 1)
+ * @var IncrementalKnapsack::backCount Pallet counts of the backward rows
+ */
+class IncrementalKnapsack
+{
+private:
+    struct Pallet
+    {
+        unsigned int id;
+        unsigned int weight;
+        unsigned int profit;
+    };
+
+    unsigned int capacity;
+    unsigned int maxCapacity;
+    std::vector<Pallet> front;
+    std::vector<Pallet> back;
+    std::vector<unsigned int> frontProfit;
+    std::vector<unsigned int> frontCount;
+    std::vector<unsigned int> backProfit;
+    std::vector<unsigned int> backCount;
+
+    void pushRow(std::vector<unsigned int> &profitRows, std::vector<unsigned int> &countRows, const Pallet &pallet);
+    void popRow(std::vector<unsigned int> &profitRows, std::vector<unsigned int> &countRows);
+    void moveGapLeft();
+    void moveGapRight();
+    unsigned int bestSplit() const;
+
+public:
+    /**
+     * @brief Builds the tables for an instance
+     * @param instance Initial manifest and truck capacity
+     * @param maxCapacity Largest capacity changeCapacity() can switch to without a rebuild
+     *                    (raised to the instance capacity if smaller); e.g.
+     *                    INCREMENTAL_CAPACITY_HEADROOM × the capacity leaves room for raises
+     * @note Time Complexity: O(n×W)
+     */
+    explicit IncrementalKnapsack(const InstanceView &instance, unsigned int maxCapacity = 0);
+
+    /**
+     * @brief Adds a pallet at the gap
+     * @param id Pallet ID
+     * @param weight Pallet weight
+     * @param profit Pallet profit value
+     * @note Time Complexity: O(W)
+     */
+    void addPallet(unsigned int id, unsigned int weight, unsigned int profit);
+
+    /**
+     * @brief Removes a pallet by ID (the one closest to the gap if the ID is repeated)
+     * @param id Pallet ID
+     * @return true if a pallet was removed, false if the ID is not in the manifest
+     * @note Time Complexity: O(W × distance), where distance is the number of pallets between the
+     *       gap and the removed one (O(W) next to the gap, O(n×W) at the far end)
+     */
+    bool removePallet(unsigned int id);
+
+    /**
+     * @brief Changes the truck capacity
+     * @param newCapacity New capacity
+     * @note Time Complexity: O(1) up to the maximum capacity; above it an O(n×W) rebuild that at
+     *       least multiplies the maximum by INCREMENTAL_CAPACITY_HEADROOM
+     */
+    void changeCapacity(unsigned int newCapacity);
+
+    /**
+     * @brief Best profit for the current manifest and capacity
+     * @return The optimal profit
+     * @note Time Complexity: O(W)
+     */
+    unsigned int bestProfit() const;
+
+    /**
+     * @brief Rebuilds an optimal selection
+     * @return The optimum, indexed like manifest()
+     * @note Time Complexity: O(n + W)
+     */
+    IncrementalSol solution() const;
+
+    /**
+     * @brief Current manifest in order, with the current capacity
+     * @return Copy of the pallets
+     */
+    Instance manifest() const;
+
+    /**
+     * @brief Number of pallets in the manifest
+     * @return Pallet count
+     */
+    unsigned int size() const { return front.size() + back.size(); }
+
+    /**
+     * @brief Current truck capacity
+     * @return Capacity
+     */
+    unsigned int truckCapacity() const { return capacity; }
+};
+
+#endif // INCREMENTALKNAPSACK_H
@@ -0,0 +1,274 @@
+#include "IntegerProgramming.h"
+#include "PythonILPWorker.h"
+#include "RadixSort.h"
+#include "../Output/ProgressBar.h"
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// branch-and-bound nodes between two cancellation checks
+static const unsigned long long CANCEL_CHECK_INTERVAL = 100000;
+
+/**
+ * Pallets in decreasing profit/weight order with prefix sums, so the LP relaxation of
+ * "pallets from position i on, with this much capacity left" is answered in O(log n).
+ */
+class RatioOrder
+{
+public:
+    std::vector<unsigned int> order;
+    std::vector<unsigned long long> prefixWeight;
+    std::vector<unsigned long long> prefixProfit;
+
+    RatioOrder(const unsigned int profits[], const unsigned int weights[], unsigned int n)
+        : order(n), prefixWeight(n + 1, 0), prefixProfit(n + 1, 0), profits(profits), weights(weights)
+    {
+        for (unsigned int i = 0; i < n; i++)
+            order[i] = i;
+        // exact ratio comparison, zero-weight pallets first; on ties keep the lower index first
+        std::stable_sort(order.begin(), order.end(),
+                         [profits, weights](unsigned int a, unsigned int b)
+                         {
+                             return ratioBefore(profits[a], weights[a], profits[b], weights[b]);
+                         });
+        for (unsigned int k = 0; k < n; k++)
+        {
+            prefixWeight[k + 1] = prefixWeight[k] + weights[order[k]];
+            prefixProfit[k + 1] = prefixProfit[k] + profits[order[k]];
+        }
+    }
+
+    // LP bound on the profit obtainable from positions [position, n) with the given residual capacity
+    unsigned long long bound(unsigned int position, unsigned long long residual) const
+    {
+        unsigned long long limit = prefixWeight[position] + residual;
+        // last position k such that all pallets in [position, k) fit
+        unsigned int k = std::upper_bound(prefixWeight.begin() + position, prefixWeight.end(), limit) -
+                         prefixWeight.begin() - 1;
+        unsigned long long value = prefixProfit[k] - prefixProfit[position];
+        if (k < order.size())
+        {
+            unsigned int breakPallet = order[k];
+            unsigned long long left = limit - prefixWeight[k];
+            value += left * profits[breakPallet] / weights[breakPallet];
+        }
+        return value;
+    }
+
+private:
+    const unsigned int *profits;
+    const unsigned int *weights;
+};
+
+/**
+ * Sums of the r largest profits among sorted positions [position, n), for r up to the pallet
+ * limit, so the "free slots" bound of a node is a table lookup.
+ */
+class SuffixTopProfits
+{
+public:
+    SuffixTopProfits(const unsigned int profits[], const std::vector<unsigned int> &order, unsigned int limit)
+        : limit(limit), table((order.size() + 1) * (limit + 1), 0)
+    {
+        // largest profits seen so far, descending, walking the positions backwards
+        std::vector<unsigned int> top;
+        for (unsigned int position = order.size(); position-- > 0;)
+        {
+            unsigned int profit = profits[order[position]];
+            top.insert(std::upper_bound(top.begin(), top.end(), profit, std::greater<unsigned int>()), profit);
+            if (top.size() > limit)
+                top.pop_back();
+
+            unsigned long long *row = &table[position * (limit + 1)];
+            for (unsigned int r = 1; r <= limit; r++)
+                row[r] = row[r - 1] + (r <= top.size() ? top[r - 1] : 0);
+        }
+    }
+
+    unsigned long long best(unsigned int position, unsigned int slots) const
+    {
+        return table[position * (limit + 1) + std::min(slots, limit)];
+    }
+
+private:
+    unsigned int limit;
+    std::vector<unsigned long long> table;
+};
+
+// Lagrangian profits max(p - multiplier, 0) of the pallet-limit relaxation
+static std::vector<unsigned int> reducedProfits(const unsigned int profits[], unsigned int n, unsigned int multiplier)
+{
+    std::vector<unsigned int> reduced(n);
+    for (unsigned int i = 0; i < n; i++)
+        reduced[i] = profits[i] > multiplier ? profits[i] - multiplier : 0;
+    return reduced;
+}
+
+// integer multiplier minimizing the Lagrangian bound multiplier × limit + Dantzig(reduced profits);
+// the bound is convex in the multiplier, so a ternary search finds it
+static unsigned int cardinalityMultiplier(const unsigned int profits[], const unsigned int weights[],
+                                          unsigned int n, unsigned int max_weight, unsigned int max_pallets)
+{
+    auto lagrangianBound = [&](unsigned int multiplier)
+    {
+        std::vector<unsigned int> reduced = reducedProfits(profits, n, multiplier);
+        return static_cast<unsigned long long>(multiplier) * max_pallets +
+               RatioOrder(reduced.data(), weights, n).bound(0, max_weight);
+    };
+
+    unsigned int low = 0, high = *std::max_element(profits, profits + n);
+    while (high - low > 2)
+    {
+        unsigned int third = (high - low) / 3;
+        if (lagrangianBound(low + third) <= lagrangianBound(high - third))
+            high = high - third;
+        else
+            low = low + third;
+    }
+    unsigned int best = low;
+    for (unsigned int multiplier = low + 1; multiplier <= high; multiplier++)
+    {
+        if (lagrangianBound(multiplier) < lagrangianBound(best))
+            best = multiplier;
+    }
+    return best;
+}
+
+ILPSol knapsackBranchAndBound(const unsigned int profits[], const unsigned int weights[],
+                              unsigned int n, unsigned int max_weight, unsigned int max_pallets,
+                              std::stop_source stop)
+{
+    ILPSol solution = {0, 0, 0, std::vector<bool>(n, false), 0, 0, "Native Branch-and-Bound"};
+
+    // a limit of n or more never binds; otherwise the search runs on the Lagrangian profits,
+    // which become the plain profits when the multiplier is 0
+    bool limited = max_pallets != 0 && max_pallets < n;
+    unsigned int multiplier = limited ? cardinalityMultiplier(profits, weights, n, max_weight, max_pallets) : 0;
+    std::vector<unsigned int> reduced = reducedProfits(profits, n, multiplier);
+    RatioOrder sorted(reduced.data(), weights, n);
+
+    // the slot bound needs its table to fit in memory
+    std::unique_ptr<SuffixTopProfits> topProfits;
+    if (limited && (n + 1ull) * (max_pallets + 1ull) <= CARDINALITY_BOUND_TABLE_LIMIT)
+        topProfits = std::make_unique<SuffixTopProfits>(profits, sorted.order, max_pallets);
+
+    // any p ≤ max(p - multiplier, 0) + multiplier, so the free slots add at most multiplier each
+    auto bound = [&](unsigned int position, unsigned long long residual, unsigned int count)
+    {
+        unsigned long long value = sorted.bound(position, residual);
+        if (limited)
+            value += static_cast<unsigned long long>(multiplier) * (max_pallets - count);
+        if (topProfits)
+            value = std::min(value, topProfits->best(position, max_pallets - count));
+        return value;
+    };
+    solution.lp_bound = static_cast<unsigned int>(bound(0, max_weight, 0));
+
+    // current path: taken[k] refers to sorted position k
+    std::vector<bool> taken(n, false);
+    std::vector<bool> bestTaken(n, false);
+    std::vector<unsigned int> takenStack;
+    unsigned long long bestProfit = 0;
+    bool haveIncumbent = false;
+
+    unsigned long long weight = 0;
+    unsigned long long profit = 0;
+    unsigned int position = 0;
+    unsigned long long nodes = 0;
+
+    ProgressBar progress(1, true);
+    bool user_cancelled = false;
+    bool stopped = false;
+
+    while (true)
+    {
+        nodes++;
+        if (nodes % CANCEL_CHECK_INTERVAL == 0)
+        {
+            if (!progress.update(nodes))
+            {
+                user_cancelled = true;
+                stop.request_stop();
+            }
+            stopped = user_cancelled || stop.stop_requested();
+            if (stopped)
+                break;
+        }
+
+        bool prune = haveIncumbent &&
+                     profit + bound(position, max_weight - weight, takenStack.size()) <= bestProfit;
+
+        if (!prune && position < n)
+        {
+            unsigned int pallet = sorted.order[position];
+            if (weight + weights[pallet] <= max_weight && (!limited || takenStack.size() < max_pallets))
+            {
+                // "take" branch first
+                taken[position] = true;
+                takenStack.push_back(position);
+                weight += weights[pallet];
+                profit += profits[pallet];
+            }
+            position++;
+            continue;
+        }
+
+        if (!prune && (!haveIncumbent || profit > bestProfit))
+        {
+            // leaf with a better loading
+            bestProfit = profit;
+            bestTaken = taken;
+            haveIncumbent = true;
+        }
+
+        // backtrack: turn the deepest "take" into a "skip"
+        if (takenStack.empty())
+            break;
+        unsigned int last = takenStack.back();
+        takenStack.pop_back();
+        unsigned int pallet = sorted.order[last];
+        taken[last] = false;
+        weight -= weights[pallet];
+        profit -= profits[pallet];
+        position = last + 1;
+    }
+
+    solution.nodes_explored = nodes;
+
+    if (stopped)
+    {
+        if (user_cancelled)
+            std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
+        return solution;
+    }
+
+    for (unsigned int k = 0; k < n; k++)
+    {
+        if (bestTaken[k])
+        {
+            unsigned int pallet = sorted.order[k];
+            solution.used_pallets[pallet] = true;
+            solution.total_profit += profits[pallet];
+            solution.total_weight += weights[pallet];
+            solution.pallet_count++;
+        }
+    }
+
+    return solution;
+}
+
+bool knapsackILPPython(const unsigned int profits[], const unsigned int weights[],
+                       unsigned int n, unsigned int max_weight, ILPSol &solution,
+                       bool persistent)
+{
+    if (persistent)
+    {
+        return sharedPythonILPWorker().solve(profits, weights, n, max_weight, solution);
+    }
+
+    // one-shot: the worker exits when it goes out of scope
+    PythonILPWorker worker;
+    return worker.solve(profits, weights, n, max_weight, solution);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file IntegerProgramming.h
+ * @brief Header for the integer linear programming approaches to the pallet loading problem
+ */
+
+#ifndef INTEGERPROGRAMMING_H
+#define INTEGERPROGRAMMING_H
+
+#include <stop_token>
+#include <vector>
+#include <string>
+
+/**
+ * @brief Largest (n + 1) × (limit + 1) table of suffix top-profit sums built for the pallet-limit
+ *        bound; beyond it only the Dantzig bound is used
+ */
+const unsigned long long CARDINALITY_BOUND_TABLE_LIMIT = 1ull << 24;
+
+/**
+ * @brief Structure to hold an integer linear programming solution
+ * @var ILPSol::total_profit Total profit of selected pallets
+ * @var ILPSol::total_weight Total weight of selected pallets
+ * @var ILPSol::pallet_count Number of pallets selected
+ * @var ILPSol::used_pallets Boolean vector indicating which pallets are used
+ * @var ILPSol::lp_bound Optimal value of the LP relaxation (rounded down), 0 if unknown
+ * @var ILPSol::nodes_explored Number of branch-and-bound nodes explored, 0 if unknown
+ * @var ILPSol::solver_name Name of the solver that produced the solution
+ */
+struct ILPSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+    unsigned int lp_bound;
+    unsigned long long nodes_explored;
+    std::string solver_name;
+};
+
+/**
+ * @brief In-process LP-relaxation based branch-and-bound for the 0/1 Knapsack ILP
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit)
+ * @param stop Stop source shared with other threads; the search gives up once a stop is requested
+ *             (checked every 100000 nodes), and Esc requests one
+ * @return ILPSol containing an optimal loading, or an empty loading when stopped
+ * @note Pallets are explored in decreasing profit/weight order (depth-first, "take" branch first).
+ *       Each node is bounded by its LP relaxation (Dantzig bound), found in O(log n) with a
+ *       binary search over prefix sums of the sorted weights.
+ * @note With a binding pallet limit K, the limit is relaxed with a Lagrangian multiplier μ: pallets
+ *       are explored in decreasing max(p - μ, 0)/weight order and each node is bounded by
+ *       μ × (free slots) + the Dantzig bound on the reduced profits. The integer μ minimizing the
+ *       root bound is found by ternary search (the bound is convex in μ). The bound is also capped
+ *       by the sum of the largest profits left, one per free slot, read from a table of suffix
+ *       top-r sums (O(n × K) to build).
+ * @note When several loadings reach the optimal profit, the first one found in ratio order is returned.
+ * @note Time Complexity: O(n log n) for sorting + O(2^n) worst case for the search, usually far less
+ * @note Space Complexity: O(n) for the sorted order, prefix sums and current selection
+ */
+ILPSol knapsackBranchAndBound(const unsigned int profits[], const unsigned int weights[],
+                              unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0,
+                              std::stop_source stop = std::stop_source(std::nostopstate));
+
+/**
+ * @brief Solves the ILP with the PuLP/CBC Python script, as a cross-check of the native solver
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param solution Output solution, filled in when the script succeeds
+ * @param persistent If true, reuse the session-wide worker process; otherwise start one just for this solve
+ * @return true if the script ran and its output could be read, false otherwise
+ * @note Requires Python 3 with PuLP installed; knapsack_solver.py is looked up in the working
+ *       directory first and then in ../Approaches.
+ * @note The instance and the result travel through pipes, no files are written.
+ */
+bool knapsackILPPython(const unsigned int profits[], const unsigned int weights[],
+                       unsigned int n, unsigned int max_weight, ILPSol &solution,
+                       bool persistent = true);
+
+#endif // INTEGERPROGRAMMING_H
@@ -0,0 +1,268 @@
+#include "LocalSearch.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <vector>
+
+static const unsigned int NO_PALLET = UINT_MAX;
+
+// check the clock only every so many evaluated moves
+static const unsigned int TIME_CHECK_INTERVAL = 1024;
+
+/**
+ * Unused pallets ordered by ascending weight, with a segment tree that returns the
+ * most profitable unused pallet among the lightest k ones.
+ */
+class ResidualIndex
+{
+public:
+    ResidualIndex(const unsigned int profits[], const unsigned int weights[], unsigned int n)
+        : profits(profits), weights(weights), byWeight(n), rank(n), sortedWeights(n)
+    {
+        for (unsigned int i = 0; i < n; i++)
+            byWeight[i] = i;
+        std::sort(byWeight.begin(), byWeight.end(),
+                  [weights](unsigned int a, unsigned int b)
+                  {
+                      if (weights[a] != weights[b])
+                          return weights[a] < weights[b];
+                      return a < b;
+                  });
+        for (unsigned int r = 0; r < n; r++)
+        {
+            rank[byWeight[r]] = r;
+            sortedWeights[r] = weights[byWeight[r]];
+        }
+
+        leaves = 1;
+        while (leaves < n)
+            leaves <<= 1;
+        tree.assign(2 * leaves, NO_PALLET);
+    }
+
+    void insert(unsigned int pallet)
+    {
+        set(rank[pallet], pallet);
+    }
+
+    void erase(unsigned int pallet)
+    {
+        set(rank[pallet], NO_PALLET);
+    }
+
+    // best unused pallet with weight <= capacity, or NO_PALLET
+    unsigned int bestFitting(unsigned long long capacity) const
+    {
+        unsigned int count = std::upper_bound(sortedWeights.begin(), sortedWeights.end(), capacity) -
+                             sortedWeights.begin();
+        unsigned int best = NO_PALLET;
+        for (unsigned int lo = leaves, hi = leaves + count; lo < hi; lo >>= 1, hi >>= 1)
+        {
+            if (lo & 1)
+                best = better(best, tree[lo++]);
+            if (hi & 1)
+                best = better(best, tree[--hi]);
+        }
+        return best;
+    }
+
+private:
+    const unsigned int *profits;
+    const unsigned int *weights;
+    std::vector<unsigned int> byWeight;
+    std::vector<unsigned int> rank;
+    std::vector<unsigned long long> sortedWeights;
+    std::vector<unsigned int> tree;
+    unsigned int leaves;
+
+    // higher profit first, then lighter, then lower index
+    unsigned int better(unsigned int a, unsigned int b) const
+    {
+        if (a == NO_PALLET)
+            return b;
+        if (b == NO_PALLET)
+            return a;
+        if (profits[a] != profits[b])
+            return profits[a] > profits[b] ? a : b;
+        if (weights[a] != weights[b])
+            return weights[a] < weights[b] ? a : b;
+        return a < b ? a : b;
+    }
+
+    void set(unsigned int position, unsigned int value)
+    {
+        unsigned int node = leaves + position;
+        tree[node] = value;
+        for (node >>= 1; node >= 1; node >>= 1)
+            tree[node] = better(tree[2 * node], tree[2 * node + 1]);
+    }
+};
+
+/**
+ * Incremental state of the solution being improved: loaded pallets with O(1) removal,
+ * running totals and the index of the pallets still available.
+ */
+struct SearchState
+{
+    const unsigned int *profits;
+    const unsigned int *weights;
+    GreedySol &solution;
+    ResidualIndex available;
+    std::vector<unsigned int> loaded;
+    std::vector<unsigned int> positionInLoaded;
+
+    SearchState(const unsigned int profits[], const unsigned int weights[], unsigned int n, GreedySol &solution)
+        : profits(profits), weights(weights), solution(solution),
+          available(profits, weights, n), positionInLoaded(n, NO_PALLET)
+    {
+        solution.total_profit = 0;
+        solution.total_weight = 0;
+        solution.pallet_count = 0;
+        for (unsigned int i = 0; i < n; i++)
+        {
+            if (solution.used_pallets[i])
+            {
+                positionInLoaded[i] = loaded.size();
+                loaded.push_back(i);
+                solution.total_profit += profits[i];
+                solution.total_weight += weights[i];
+                solution.pallet_count++;
+            }
+            else
+            {
+                available.insert(i);
+            }
+        }
+    }
+
+    void load(unsigned int pallet)
+    {
+        available.erase(pallet);
+        positionInLoaded[pallet] = loaded.size();
+        loaded.push_back(pallet);
+        solution.used_pallets[pallet] = true;
+        solution.total_profit += profits[pallet];
+        solution.total_weight += weights[pallet];
+        solution.pallet_count++;
+    }
+
+    void unload(unsigned int pallet)
+    {
+        unsigned int position = positionInLoaded[pallet];
+        loaded[position] = loaded.back();
+        positionInLoaded[loaded[position]] = position;
+        loaded.pop_back();
+        positionInLoaded[pallet] = NO_PALLET;
+        available.insert(pallet);
+        solution.used_pallets[pallet] = false;
+        solution.total_profit -= profits[pallet];
+        solution.total_weight -= weights[pallet];
+        solution.pallet_count--;
+    }
+};
+
+LocalSearchStats improveGreedySolution(const unsigned int profits[], const unsigned int weights[],
+                                       unsigned int n, unsigned int max_weight,
+                                       GreedySol &solution, double time_budget_ms,
+                                       unsigned int max_pallets)
+{
+    auto start = std::chrono::steady_clock::now();
+    LocalSearchStats stats = {0, 0, 0, 0, 0, 0, false, 0.0};
+
+    solution.used_pallets.resize(n, false);
+    SearchState state(profits, weights, n, solution);
+    unsigned int startProfit = solution.total_profit;
+
+    unsigned int evaluations = 0;
+    bool outOfTime = false;
+    auto budgetLeft = [&]()
+    {
+        if (++evaluations % TIME_CHECK_INTERVAL == 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            outOfTime = std::chrono::duration<double, std::milli>(now - start).count() > time_budget_ms;
+        }
+        return !outOfTime;
+    };
+
+    bool improved = true;
+    while (improved && budgetLeft())
+    {
+        improved = false;
+
+        // add: fill the residual capacity with the most profitable pallet that fits
+        bool slotFree = max_pallets == 0 || solution.pallet_count < max_pallets;
+        unsigned int candidate = slotFree ? state.available.bestFitting(max_weight - solution.total_weight) : NO_PALLET;
+        if (candidate != NO_PALLET && profits[candidate] > 0)
+        {
+            state.load(candidate);
+            stats.add_moves++;
+            improved = true;
+            continue;
+        }
+
+        // drop: zero-profit pallets only cost a slot
+        for (unsigned int k = 0; k < state.loaded.size() && !improved; k++)
+        {
+            if (profits[state.loaded[k]] == 0)
+            {
+                state.unload(state.loaded[k]);
+                stats.drop_moves++;
+                improved = true;
+            }
+        }
+        if (improved)
+            continue;
+
+        unsigned long long residual = max_weight - solution.total_weight;
+
+        // 1-for-1: replace a loaded pallet with a more profitable one that fits in its place
+        for (unsigned int k = 0; k < state.loaded.size() && !improved && budgetLeft(); k++)
+        {
+            unsigned int out = state.loaded[k];
+            unsigned int in = state.available.bestFitting(residual + weights[out]);
+            if (in != NO_PALLET && profits[in] > profits[out])
+            {
+                state.unload(out);
+                state.load(in);
+                stats.swap_moves++;
+                improved = true;
+            }
+        }
+        if (improved)
+            continue;
+
+        // 2-for-1: replace two loaded pallets with one more profitable than both together
+        for (unsigned int a = 0; a < state.loaded.size() && !improved; a++)
+        {
+            for (unsigned int b = a + 1; b < state.loaded.size() && !improved && budgetLeft(); b++)
+            {
+                unsigned int outA = state.loaded[a];
+                unsigned int outB = state.loaded[b];
+                unsigned int in = state.available.bestFitting(residual + weights[outA] + weights[outB]);
+                if (in != NO_PALLET &&
+                    (profits[in] > profits[outA] + profits[outB] ||
+                     (profits[in] == profits[outA] + profits[outB] && profits[in] > 0)))
+                {
+                    state.unload(outA);
+                    state.unload(outB);
+                    state.load(in);
+                    stats.pair_swap_moves++;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    stats.local_optimum = !improved && !outOfTime;
+    stats.moves_made = stats.add_moves + stats.drop_moves + stats.swap_moves + stats.pair_swap_moves;
+    stats.profit_gained = solution.total_profit - startProfit;
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (stats.moves_made > 0)
+    {
+        solution.approach_name += " + Local Search";
+    }
+
+    return stats;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file LocalSearch.h
+ * @brief Local-search improvement stage for greedy pallet loading solutions
+ */
+
+#ifndef LOCALSEARCH_H
+#define LOCALSEARCH_H
+
+#include "Greedy.h"
+
+/**
+ * @brief Default time budget of the improvement stage in milliseconds
+ */
+const double LOCAL_SEARCH_DEFAULT_BUDGET_MS = 1000.0;
+
+/**
+ * @brief Structure to hold the outcome of the local-search improvement stage
+ * @var LocalSearchStats::profit_gained Profit added on top of the starting solution
+ * @var LocalSearchStats::moves_made Total number of moves applied
+ * @var LocalSearchStats::add_moves Number of pallets added into free capacity
+ * @var LocalSearchStats::drop_moves Number of zero-profit pallets dropped
+ * @var LocalSearchStats::swap_moves Number of 1-for-1 swaps applied
+ * @var LocalSearchStats::pair_swap_moves Number of 2-for-1 swaps applied
+ * @var LocalSearchStats::local_optimum Whether the search stopped at a local optimum (false if the budget ran out)
+ * @var LocalSearchStats::elapsed_ms Time spent in the improvement stage in milliseconds
+ */
+struct LocalSearchStats
+{
+    unsigned int profit_gained;
+    unsigned int moves_made;
+    unsigned int add_moves;
+    unsigned int drop_moves;
+    unsigned int swap_moves;
+    unsigned int pair_swap_moves;
+    bool local_optimum;
+    double elapsed_ms;
+};
+
+/**
+ * @brief Improves a greedy solution with add, drop, 1-for-1 and 2-for-1 swap moves
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param solution Greedy solution to improve in place (used_pallets, totals and approach name are updated)
+ * @param time_budget_ms Maximum time to spend improving, in milliseconds
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit); add moves stop
+ *                    at the limit, the other moves never increase the pallet count
+ * @return LocalSearchStats describing the profit gained and the moves made
+ * @note Unused pallets are kept in a max-profit segment tree laid out in ascending weight order,
+ *       so the best pallet fitting a given residual capacity is found with one binary search
+ *       and one tree query.
+ * @note Moves are only applied when they increase the profit, or keep it and reduce the pallet count.
+ * @note Time Complexity: O(log n) per evaluated move; a sweep evaluates O(m^2) moves for m loaded pallets
+ * @note Space Complexity: O(n) for the weight index and the segment tree
+ */
+LocalSearchStats improveGreedySolution(const unsigned int profits[], const unsigned int weights[],
+                                       unsigned int n, unsigned int max_weight,
+                                       GreedySol &solution,
+                                       double time_budget_ms = LOCAL_SEARCH_DEFAULT_BUDGET_MS,
+                                       unsigned int max_pallets = 0);
+
+#endif // LOCALSEARCH_H
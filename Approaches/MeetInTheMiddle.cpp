@@ -0,0 +1,108 @@
+#include "MeetInTheMiddle.h"
+#include <algorithm>
+
+// one subset of a half: its total weight and profit, and which pallets of the half it holds
+struct HalfSubset
+{
+    unsigned long long weight;
+    unsigned long long profit;
+    unsigned int mask;
+};
+
+// every subset of pallets [first, first + count) that fits, in increasing weight (cut short when stopped)
+static std::vector<HalfSubset> listSubsets(const unsigned int profits[], const unsigned int weights[],
+                                           unsigned int first, unsigned int count, unsigned int max_weight,
+                                           const std::stop_source &stop)
+{
+    std::vector<HalfSubset> subsets = {{0, 0, 0}};
+    std::vector<HalfSubset> merged;
+    for (unsigned int k = 0; k < count && !stop.stop_requested(); k++)
+    {
+        unsigned int weight = weights[first + k];
+        unsigned int profit = profits[first + k];
+
+        // the subsets with pallet k are the old ones shifted by its weight, so still sorted
+        merged.clear();
+        merged.reserve(2 * subsets.size());
+        size_t a = 0, b = 0;
+        while (a < subsets.size() || b < subsets.size())
+        {
+            bool takeShifted = b < subsets.size() && subsets[b].weight + weight <= max_weight &&
+                               (a == subsets.size() || subsets[b].weight + weight < subsets[a].weight);
+            if (takeShifted)
+            {
+                merged.push_back({subsets[b].weight + weight, subsets[b].profit + profit, subsets[b].mask | (1u << k)});
+                b++;
+            }
+            else if (a < subsets.size())
+            {
+                merged.push_back(subsets[a++]);
+            }
+            else
+            {
+                break;
+            }
+        }
+        subsets.swap(merged);
+    }
+    return subsets;
+}
+
+MITMSol knapsackMeetInTheMiddle(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, unsigned int max_weight, std::stop_source stop)
+{
+    MITMSol solution = {0, 0, 0, std::vector<bool>(n, false)};
+    unsigned int half = n / 2;
+
+    std::vector<HalfSubset> left = listSubsets(profits, weights, 0, half, max_weight, stop);
+    std::vector<HalfSubset> right = listSubsets(profits, weights, half, n - half, max_weight, stop);
+    if (stop.stop_requested())
+        return solution;
+
+    // keep only the left subsets more profitable than every lighter one
+    size_t kept = 0;
+    for (const HalfSubset &subset : left)
+    {
+        if (kept == 0 || subset.profit > left[kept - 1].profit)
+            left[kept++] = subset;
+    }
+    left.resize(kept);
+
+    // heavier right subsets leave less room, so the best left partner only moves down
+    unsigned long long bestProfit = 0;
+    size_t bestLeft = 0, bestRight = 0;
+    size_t partner = left.size() - 1;
+    for (size_t r = 0; r < right.size(); r++)
+    {
+        unsigned long long room = max_weight - right[r].weight;
+        while (left[partner].weight > room)
+            partner--;
+        if (left[partner].profit + right[r].profit > bestProfit)
+        {
+            bestProfit = left[partner].profit + right[r].profit;
+            bestLeft = partner;
+            bestRight = r;
+        }
+    }
+
+    for (unsigned int k = 0; k < half; k++)
+    {
+        if (left[bestLeft].mask & (1u << k))
+            solution.used_pallets[k] = true;
+    }
+    for (unsigned int k = 0; k < n - half; k++)
+    {
+        if (right[bestRight].mask & (1u << k))
+            solution.used_pallets[half + k] = true;
+    }
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            solution.total_profit += profits[i];
+            solution.total_weight += weights[i];
+            solution.pallet_count++;
+        }
+    }
+    return solution;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file MeetInTheMiddle.h
+ * @brief Header for the meet-in-the-middle (Horowitz-Sahni) approach for 0/1 Knapsack
+ */
+
+#ifndef MEETINTHEMIDDLE_H
+#define MEETINTHEMIDDLE_H
+#include <stop_token>
+#include <vector>
+
+/**
+ * @brief Largest number of pallets the meet-in-the-middle search is started on (2^(n/2) subsets per half)
+ */
+const unsigned int MITM_MAX_PALLETS = 40;
+
+/**
+ * @brief Structure to hold pallet loading solution for the meet-in-the-middle approach
+ * @var MITMSol::total_profit Total profit of selected pallets
+ * @var MITMSol::total_weight Total weight of selected pallets
+ * @var MITMSol::pallet_count Number of pallets selected
+ * @var MITMSol::used_pallets Boolean vector indicating which pallets are used
+ */
+struct MITMSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+};
+
+/**
+ * @brief Meet-in-the-middle pallet loading algorithm
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets (at most MITM_MAX_PALLETS)
+ * @param max_weight Maximum weight capacity of truck
+ * @param stop Stop source shared with other threads; the merges give up once a stop is requested
+ * @return MITMSol containing an optimal loading, or an empty loading when stopped
+ * @note The pallets are split in two halves. The subsets of each half that fit are listed in
+ *       increasing weight by merging (adding one pallet doubles the sorted list), the first list
+ *       keeps only subsets more profitable than every lighter one, and a two-pointer sweep pairs
+ *       each subset of the second half with the best subset of the first that still fits.
+ * @note Does not take a pallet limit.
+ * @note Time Complexity: O(2^(n/2)) for the merges and the sweep
+ * @note Space Complexity: O(2^(n/2)) for the two subset lists
+ */
+MITMSol knapsackMeetInTheMiddle(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, unsigned int max_weight,
+                                std::stop_source stop = std::stop_source(std::nostopstate));
+
+#endif // MEETINTHEMIDDLE_H
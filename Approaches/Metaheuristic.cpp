@@ -0,0 +1,394 @@
+#include "Metaheuristic.h"
+#include "Greedy.h"
+#include "RadixSort.h"
+#include "../Output/ProgressBar.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+// moves evaluated between two clock checks
+static const unsigned int CHECK_INTERVAL = 1024;
+
+// clock checks between two elite exchanges
+static const unsigned int EXCHANGE_INTERVAL = 32;
+
+// final temperature of the geometric cooling schedule
+static const double FINAL_TEMPERATURE = 0.01;
+
+/**
+ * xoshiro256** generator (Blackman & Vigna), seeded through splitmix64
+ */
+class Xoshiro256
+{
+public:
+    explicit Xoshiro256(uint64_t seed)
+    {
+        for (uint64_t &word : state)
+        {
+            seed += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    uint64_t next()
+    {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    // uniform in [0, bound)
+    unsigned int below(unsigned int bound)
+    {
+        return static_cast<unsigned int>(((next() >> 32) * bound) >> 32);
+    }
+
+    // uniform in [0, 1)
+    double uniform()
+    {
+        return (next() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+/**
+ * Solution of one chain: a bitset plus the list of loaded pallets for O(1) random removal
+ */
+class BitsetSolution
+{
+public:
+    std::vector<uint64_t> bits;
+    std::vector<unsigned int> loaded;
+    unsigned long long profit = 0;
+    unsigned long long weight = 0;
+
+    BitsetSolution(unsigned int n) : bits((n + 63) / 64, 0), position(n, 0) {}
+
+    bool has(unsigned int pallet) const
+    {
+        return (bits[pallet >> 6] >> (pallet & 63)) & 1;
+    }
+
+    void load(unsigned int pallet, const unsigned int profits[], const unsigned int weights[])
+    {
+        bits[pallet >> 6] |= 1ULL << (pallet & 63);
+        position[pallet] = loaded.size();
+        loaded.push_back(pallet);
+        profit += profits[pallet];
+        weight += weights[pallet];
+    }
+
+    void unload(unsigned int pallet, const unsigned int profits[], const unsigned int weights[])
+    {
+        bits[pallet >> 6] &= ~(1ULL << (pallet & 63));
+        unsigned int slot = position[pallet];
+        loaded[slot] = loaded.back();
+        position[loaded[slot]] = slot;
+        loaded.pop_back();
+        profit -= profits[pallet];
+        weight -= weights[pallet];
+    }
+
+    void assign(const std::vector<uint64_t> &other, const unsigned int profits[], const unsigned int weights[])
+    {
+        bits.assign(bits.size(), 0);
+        loaded.clear();
+        profit = 0;
+        weight = 0;
+        for (unsigned int word = 0; word < other.size(); word++)
+        {
+            for (uint64_t rest = other[word]; rest != 0; rest &= rest - 1)
+            {
+                load(word * 64 + __builtin_ctzll(rest), profits, weights);
+            }
+        }
+    }
+
+private:
+    std::vector<unsigned int> position;
+};
+
+/**
+ * Elite solution shared by all chains, plus the stop condition
+ */
+struct SharedElite
+{
+    std::mutex mutex;
+    std::vector<uint64_t> bits;
+    unsigned long long profit = 0;
+    unsigned long long count = 0;
+    std::vector<ProfitSample> curve;
+    std::atomic<bool> stop{false};
+    std::atomic<unsigned long long> iterations{0};
+};
+
+// higher profit first, then fewer pallets
+static bool isBetter(unsigned long long profit, unsigned long long count,
+                     unsigned long long otherProfit, unsigned long long otherCount)
+{
+    return profit > otherProfit || (profit == otherProfit && count < otherCount);
+}
+
+// Dantzig bound: LP relaxation of the knapsack, filling by exact profit/weight ratio
+static unsigned long long lpUpperBound(const unsigned int profits[], const unsigned int weights[],
+                                       unsigned int n, unsigned int max_weight)
+{
+    std::vector<unsigned int> order(n);
+    for (unsigned int i = 0; i < n; i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(),
+              [profits, weights](unsigned int a, unsigned int b)
+              {
+                  return ratioBefore(profits[a], weights[a], profits[b], weights[b]);
+              });
+
+    unsigned long long residual = max_weight;
+    unsigned long long bound = 0;
+    for (unsigned int idx : order)
+    {
+        if (weights[idx] <= residual)
+        {
+            residual -= weights[idx];
+            bound += profits[idx];
+        }
+        else
+        {
+            bound += residual * profits[idx] / weights[idx];
+            break;
+        }
+    }
+    return bound;
+}
+
+MetaheuristicSol knapsackSimulatedAnnealing(const unsigned int profits[], const unsigned int weights[],
+                                            unsigned int n, unsigned int max_weight,
+                                            double time_budget_ms, double target_gap,
+                                            unsigned int chains)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto elapsedMs = [start]()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    if (chains == 0)
+    {
+        chains = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    MetaheuristicSol solution = {0, 0, 0, std::vector<bool>(n, false), 0, chains, 0, {}};
+    unsigned long long upperBound = lpUpperBound(profits, weights, n, max_weight);
+    solution.upper_bound = static_cast<unsigned int>(upperBound);
+
+    if (n == 0)
+    {
+        return solution;
+    }
+
+    // every chain starts from the greedy ratio solution
+    GreedySol greedy = knapsackGreedyRatio(profits, weights, n, max_weight);
+    BitsetSolution initial(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (greedy.used_pallets[i])
+            initial.load(i, profits, weights);
+    }
+
+    SharedElite elite;
+    elite.bits = initial.bits;
+    elite.profit = initial.profit;
+    elite.count = initial.loaded.size();
+    elite.curve.push_back({elapsedMs(), static_cast<unsigned int>(initial.profit)});
+
+    auto reachedTarget = [&](unsigned long long profit)
+    {
+        return upperBound - profit <= target_gap * upperBound;
+    };
+    if (reachedTarget(elite.profit))
+    {
+        elite.stop = true;
+    }
+
+    // each chain publishes its elapsed milliseconds to its own counter, so the bar shows their average
+    unsigned long long budgetTicks = static_cast<unsigned long long>(std::clamp(time_budget_ms, 1.0, 1e12));
+    ProgressBar progress(budgetTicks * chains, false, chains);
+    std::atomic<bool> userCancelled = false;
+
+    // start the temperature so that losing an average loaded profit is accepted about a third of the time
+    double averageProfit = initial.loaded.empty() ? 1.0
+                                                  : static_cast<double>(initial.profit) / initial.loaded.size();
+    double baseTemperature = std::max(1.0, averageProfit);
+
+    auto runChain = [&](unsigned int chain)
+    {
+        Xoshiro256 rng(0x6B6E6170747275ULL + chain);
+        BitsetSolution current = initial;
+        std::vector<uint64_t> bestBits = current.bits;
+        unsigned long long bestProfit = current.profit;
+        unsigned long long bestCount = current.loaded.size();
+        std::vector<unsigned int> removed;
+
+        // spread the starting temperatures so the chains explore differently
+        double startTemperature = baseTemperature * (1.0 + 0.5 * chain);
+        double temperature = startTemperature;
+        unsigned int checks = 0;
+
+        auto exchange = [&]()
+        {
+            std::lock_guard<std::mutex> lock(elite.mutex);
+            if (isBetter(bestProfit, bestCount, elite.profit, elite.count))
+            {
+                elite.bits = bestBits;
+                elite.profit = bestProfit;
+                elite.count = bestCount;
+                if (elite.curve.back().profit != bestProfit)
+                {
+                    elite.curve.push_back({elapsedMs(), static_cast<unsigned int>(bestProfit)});
+                }
+                if (reachedTarget(bestProfit))
+                {
+                    elite.stop = true;
+                }
+            }
+            else if (isBetter(elite.profit, elite.count, bestProfit, bestCount))
+            {
+                // fallen behind: restart from the elite
+                current.assign(elite.bits, profits, weights);
+                bestBits = elite.bits;
+                bestProfit = elite.profit;
+                bestCount = elite.count;
+            }
+        };
+
+        while (!elite.stop.load(std::memory_order_relaxed))
+        {
+            for (unsigned int k = 0; k < CHECK_INTERVAL; k++)
+            {
+                unsigned int pallet = rng.below(n);
+                if (current.has(pallet))
+                {
+                    double delta = -static_cast<double>(profits[pallet]);
+                    if (rng.uniform() < std::exp(delta / temperature))
+                    {
+                        current.unload(pallet, profits, weights);
+                    }
+                    continue;
+                }
+
+                if (weights[pallet] > max_weight)
+                {
+                    continue;
+                }
+
+                // add the pallet, then drop random loaded pallets until the truck fits again
+                current.load(pallet, profits, weights);
+                removed.clear();
+                double delta = profits[pallet];
+                while (current.weight > max_weight)
+                {
+                    unsigned int victim = current.loaded[rng.below(current.loaded.size())];
+                    if (victim == pallet)
+                        continue;
+                    current.unload(victim, profits, weights);
+                    removed.push_back(victim);
+                    delta -= profits[victim];
+                }
+
+                if (delta >= 0 || rng.uniform() < std::exp(delta / temperature))
+                {
+                    if (isBetter(current.profit, current.loaded.size(), bestProfit, bestCount))
+                    {
+                        bestBits = current.bits;
+                        bestProfit = current.profit;
+                        bestCount = current.loaded.size();
+                    }
+                }
+                else
+                {
+                    current.unload(pallet, profits, weights);
+                    for (unsigned int victim : removed)
+                        current.load(victim, profits, weights);
+                }
+            }
+            elite.iterations.fetch_add(CHECK_INTERVAL, std::memory_order_relaxed);
+
+            double elapsed = elapsedMs();
+            if (elapsed >= time_budget_ms)
+            {
+                elite.stop = true;
+            }
+            else if (progress.shouldShow() &&
+                     !progress.update(std::min<unsigned long long>(elapsed, budgetTicks), chain))
+            {
+                // Esc ends the search early, the best loading so far is still returned
+                userCancelled = true;
+                elite.stop = true;
+            }
+
+            // geometric cooling over the time budget
+            double progress = std::min(1.0, elapsed / time_budget_ms);
+            temperature = startTemperature * std::pow(FINAL_TEMPERATURE / startTemperature, progress);
+
+            if (++checks % EXCHANGE_INTERVAL == 0)
+            {
+                exchange();
+            }
+        }
+        exchange();
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned int chain = 1; chain < chains; chain++)
+    {
+        workers.emplace_back(runChain, chain);
+    }
+    runChain(0);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    if (userCancelled)
+    {
+        std::cout << "\nSearch stopped by user. Showing the best loading found so far." << std::endl;
+    }
+    else
+    {
+        progress.complete();
+    }
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if ((elite.bits[i >> 6] >> (i & 63)) & 1)
+        {
+            solution.used_pallets[i] = true;
+            solution.total_profit += profits[i];
+            solution.total_weight += weights[i];
+            solution.pallet_count++;
+        }
+    }
+    solution.iterations = elite.iterations;
+    solution.profit_curve = elite.curve;
+
+    return solution;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Metaheuristic.h
+ * @brief Header for the parallel simulated annealing metaheuristic for 0/1 Knapsack
+ */
+
+#ifndef METAHEURISTIC_H
+#define METAHEURISTIC_H
+
+#include <vector>
+
+/**
+ * @brief Default time budget of the metaheuristic in milliseconds
+ */
+const double METAHEURISTIC_DEFAULT_BUDGET_MS = 2000.0;
+
+/**
+ * @brief Default relative gap to the LP upper bound at which the search stops early
+ */
+const double METAHEURISTIC_DEFAULT_TARGET_GAP = 0.0;
+
+/**
+ * @brief Point of the profit-vs-time curve, recorded whenever the best known profit improves
+ * @var ProfitSample::time_ms Time since the start of the search in milliseconds
+ * @var ProfitSample::profit Best profit known at that time
+ */
+struct ProfitSample
+{
+    double time_ms;
+    unsigned int profit;
+};
+
+/**
+ * @brief Structure to hold the metaheuristic solution
+ * @var MetaheuristicSol::total_profit Total profit of selected pallets
+ * @var MetaheuristicSol::total_weight Total weight of selected pallets
+ * @var MetaheuristicSol::pallet_count Number of pallets selected
+ * @var MetaheuristicSol::used_pallets Boolean vector indicating which pallets are used
+ * @var MetaheuristicSol::upper_bound LP relaxation bound used to compute the gap
+ * @var MetaheuristicSol::chains Number of annealing chains that ran in parallel
+ * @var MetaheuristicSol::iterations Total number of moves evaluated over all chains
+ * @var MetaheuristicSol::profit_curve Best profit over time
+ */
+struct MetaheuristicSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+    unsigned int upper_bound;
+    unsigned int chains;
+    unsigned long long iterations;
+    std::vector<ProfitSample> profit_curve;
+};
+
+/**
+ * @brief Parallel simulated annealing for large pallet manifests
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param time_budget_ms Time after which the search stops, in milliseconds
+ * @param target_gap Relative gap to the LP upper bound at which the search stops early (0 stops only at the bound)
+ * @param chains Number of independent chains, one per thread (0 uses the hardware concurrency)
+ * @return MetaheuristicSol containing the best loading found and its profit-vs-time curve
+ * @note Each chain starts from the greedy ratio solution and owns its own xoshiro256** generator
+ *       and bitset solution. Chains periodically publish their best solution as the shared elite,
+ *       and chains that fall behind restart from it.
+ * @note Every chain reports its share of the time budget to one progress bar, on its own counter;
+ *       pressing Esc stops all chains and returns the best loading found so far.
+ * @note Not guaranteed to be optimal; optimality is only proven when the bound is reached.
+ * @note Time Complexity: bounded by the time budget; O(1) expected per move
+ * @note Space Complexity: O(n) per chain
+ */
+MetaheuristicSol knapsackSimulatedAnnealing(const unsigned int profits[], const unsigned int weights[],
+                                            unsigned int n, unsigned int max_weight,
+                                            double time_budget_ms = METAHEURISTIC_DEFAULT_BUDGET_MS,
+                                            double target_gap = METAHEURISTIC_DEFAULT_TARGET_GAP,
+                                            unsigned int chains = 0);
+
+#endif // METAHEURISTIC_H
@@ -0,0 +1,307 @@
+#include "MultipleKnapsack.h"
+#include "OnlineKnapsack.h"
+#include "RadixSort.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/**
+ * A new loading for one or two trucks, computed against the assignment at the start of a round.
+ */
+struct FleetProposal
+{
+    long long gain;
+    std::vector<unsigned int> trucks;
+    std::vector<std::vector<unsigned int>> loads;
+};
+
+// true if pallet a has a strictly better profit/weight ratio than pallet b
+static bool betterRatio(const unsigned int profits[], const unsigned int weights[], unsigned int a, unsigned int b)
+{
+    return ratioBefore(profits[a], weights[a], profits[b], weights[b]);
+}
+
+static unsigned int loadProfit(const unsigned int profits[], const std::vector<unsigned int> &load)
+{
+    unsigned int total = 0;
+    for (unsigned int pallet : load)
+        total += profits[pallet];
+    return total;
+}
+
+// best loading of one truck among the candidate pallets, returned in ascending index order
+static std::vector<unsigned int> solveTruck(const unsigned int profits[], const unsigned int weights[],
+                                            const std::vector<unsigned int> &candidates, unsigned int capacity)
+{
+    std::vector<unsigned int> fitting;
+    for (unsigned int pallet : candidates)
+    {
+        if (weights[pallet] <= capacity)
+            fitting.push_back(pallet);
+    }
+
+    std::vector<unsigned int> chosen;
+    if (static_cast<unsigned long long>(fitting.size()) * (capacity + 1ull) <= MULTI_TRUCK_DP_CELL_LIMIT)
+    {
+        // exact: the online DP is silent and self-contained, so it is safe to run one per thread
+        OnlineKnapsack dp(capacity);
+        for (unsigned int pallet : fitting)
+            dp.addPallet(pallet, weights[pallet], profits[pallet]);
+        OnlineSol solution = dp.solution();
+        for (unsigned int k = 0; k < fitting.size(); k++)
+        {
+            if (solution.used_pallets[k])
+                chosen.push_back(fitting[k]);
+        }
+        return chosen;
+    }
+
+    // too large for the DP: fill by decreasing profit/weight ratio
+    std::vector<unsigned int> order = fitting;
+    std::stable_sort(order.begin(), order.end(),
+                     [profits, weights](unsigned int a, unsigned int b)
+                     { return betterRatio(profits, weights, a, b); });
+    unsigned long long weight = 0;
+    for (unsigned int pallet : order)
+    {
+        if (weight + weights[pallet] <= capacity)
+        {
+            chosen.push_back(pallet);
+            weight += weights[pallet];
+        }
+    }
+    std::sort(chosen.begin(), chosen.end());
+    return chosen;
+}
+
+// runs task(0..tasks-1) on up to `threads` threads
+static void runParallel(unsigned int tasks, unsigned int threads, const std::function<void(unsigned int)> &task)
+{
+    std::atomic<unsigned int> next(0);
+    auto worker = [&]()
+    {
+        for (unsigned int t = next++; t < tasks; t = next++)
+            task(t);
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned int i = 1; i < std::min(threads, tasks); i++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &thread : pool)
+        thread.join();
+}
+
+unsigned long long fleetSurrogateBound(const unsigned int profits[], const unsigned int weights[],
+                                       unsigned int n, const std::vector<unsigned int> &capacities)
+{
+    unsigned long long totalCapacity = 0;
+    unsigned int largest = 0;
+    for (unsigned int capacity : capacities)
+    {
+        totalCapacity += capacity;
+        largest = std::max(largest, capacity);
+    }
+
+    std::vector<unsigned int> order;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (weights[i] <= largest)
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [profits, weights](unsigned int a, unsigned int b)
+              { return betterRatio(profits, weights, a, b); });
+
+    // Dantzig bound of the merged knapsack
+    unsigned long long bound = 0;
+    unsigned long long remaining = totalCapacity;
+    for (unsigned int pallet : order)
+    {
+        if (weights[pallet] <= remaining)
+        {
+            bound += profits[pallet];
+            remaining -= weights[pallet];
+        }
+        else
+        {
+            bound += static_cast<unsigned long long>(profits[pallet]) * remaining / weights[pallet];
+            break;
+        }
+    }
+    return bound;
+}
+
+FleetSol knapsackMultipleTrucks(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, const std::vector<unsigned int> &capacities,
+                                unsigned int threads)
+{
+    unsigned int m = capacities.size();
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    FleetSol solution;
+    solution.upper_bound = fleetSurrogateBound(profits, weights, n, capacities);
+    solution.rounds = 0;
+
+    std::vector<int> assigned(n, -1);
+    std::vector<std::vector<unsigned int>> loads(m);
+    unsigned long long total = 0;
+
+    auto unassignedPallets = [&]()
+    {
+        std::vector<unsigned int> pallets;
+        for (unsigned int i = 0; i < n; i++)
+        {
+            if (assigned[i] < 0)
+                pallets.push_back(i);
+        }
+        return pallets;
+    };
+
+    auto setLoad = [&](unsigned int truck, const std::vector<unsigned int> &load)
+    {
+        total -= loadProfit(profits, loads[truck]);
+        for (unsigned int pallet : loads[truck])
+            assigned[pallet] = -1;
+        loads[truck] = load;
+        for (unsigned int pallet : load)
+            assigned[pallet] = truck;
+        total += loadProfit(profits, load);
+    };
+
+    // trucks from largest to smallest
+    std::vector<unsigned int> bySize(m);
+    for (unsigned int t = 0; t < m; t++)
+        bySize[t] = t;
+    std::stable_sort(bySize.begin(), bySize.end(),
+                     [&capacities](unsigned int a, unsigned int b) { return capacities[a] > capacities[b]; });
+
+    // greedy construction: each truck takes its best loading among the pallets left
+    for (unsigned int truck : bySize)
+        setLoad(truck, solveTruck(profits, weights, unassignedPallets(), capacities[truck]));
+
+    // improvement loop
+    while (solution.rounds < MULTI_TRUCK_MAX_ROUNDS && total < solution.upper_bound)
+    {
+        solution.rounds++;
+        std::vector<unsigned int> unassigned = unassignedPallets();
+
+        // tasks: every truck alone, then every pair of neighbouring trucks (by size)
+        std::vector<std::vector<unsigned int>> tasks;
+        for (unsigned int truck : bySize)
+            tasks.push_back({truck});
+        for (unsigned int k = 0; k + 1 < m; k++)
+            tasks.push_back({bySize[k], bySize[k + 1]});
+
+        std::vector<FleetProposal> proposals(tasks.size());
+        runParallel(tasks.size(), threads, [&](unsigned int task)
+        {
+            const std::vector<unsigned int> &trucks = tasks[task];
+            std::vector<unsigned int> pool = unassigned;
+            long long oldProfit = 0;
+            for (unsigned int truck : trucks)
+            {
+                pool.insert(pool.end(), loads[truck].begin(), loads[truck].end());
+                oldProfit += loadProfit(profits, loads[truck]);
+            }
+            std::sort(pool.begin(), pool.end());
+
+            FleetProposal &proposal = proposals[task];
+            proposal.trucks = trucks;
+            proposal.gain = 0;
+            if (trucks.size() == 1)
+            {
+                proposal.loads = {solveTruck(profits, weights, pool, capacities[trucks[0]])};
+                proposal.gain = static_cast<long long>(loadProfit(profits, proposal.loads[0])) - oldProfit;
+                return;
+            }
+
+            // repack the pair, trying both trucks first
+            for (unsigned int first = 0; first < 2; first++)
+            {
+                unsigned int a = trucks[first], b = trucks[1 - first];
+                std::vector<unsigned int> loadA = solveTruck(profits, weights, pool, capacities[a]);
+                std::vector<unsigned int> rest;
+                std::set_difference(pool.begin(), pool.end(), loadA.begin(), loadA.end(), std::back_inserter(rest));
+                std::vector<unsigned int> loadB = solveTruck(profits, weights, rest, capacities[b]);
+
+                long long gain = static_cast<long long>(loadProfit(profits, loadA)) +
+                                 loadProfit(profits, loadB) - oldProfit;
+                if (gain > proposal.gain)
+                {
+                    proposal.gain = gain;
+                    proposal.loads = first == 0 ? std::vector<std::vector<unsigned int>>{loadA, loadB}
+                                                : std::vector<std::vector<unsigned int>>{loadB, loadA};
+                }
+            }
+        });
+
+        // apply the improving proposals by decreasing gain, skipping the ones that conflict
+        std::stable_sort(proposals.begin(), proposals.end(),
+                         [](const FleetProposal &a, const FleetProposal &b) { return a.gain > b.gain; });
+        std::vector<bool> touched(m, false);
+        bool improved = false;
+        for (const FleetProposal &proposal : proposals)
+        {
+            if (proposal.gain <= 0)
+                break;
+
+            bool valid = true;
+            for (unsigned int truck : proposal.trucks)
+                valid = valid && !touched[truck];
+            for (unsigned int k = 0; k < proposal.loads.size() && valid; k++)
+            {
+                for (unsigned int pallet : proposal.loads[k])
+                {
+                    int owner = assigned[pallet];
+                    if (owner >= 0 && std::find(proposal.trucks.begin(), proposal.trucks.end(),
+                                                static_cast<unsigned int>(owner)) == proposal.trucks.end())
+                    {
+                        valid = false;
+                        break;
+                    }
+                }
+            }
+            if (!valid)
+                continue;
+
+            // release every truck of the proposal first, so pallets can move between them
+            for (unsigned int truck : proposal.trucks)
+                setLoad(truck, {});
+            for (unsigned int k = 0; k < proposal.trucks.size(); k++)
+            {
+                setLoad(proposal.trucks[k], proposal.loads[k]);
+                touched[proposal.trucks[k]] = true;
+            }
+            improved = true;
+        }
+
+        if (!improved)
+            break;
+    }
+
+    solution.total_profit = 0;
+    solution.total_weight = 0;
+    solution.pallet_count = 0;
+    solution.assigned_truck = assigned;
+    solution.trucks.resize(m);
+    for (unsigned int t = 0; t < m; t++)
+    {
+        TruckLoad &truck = solution.trucks[t];
+        truck.capacity = capacities[t];
+        truck.pallets = loads[t];
+        std::sort(truck.pallets.begin(), truck.pallets.end());
+        truck.total_profit = loadProfit(profits, truck.pallets);
+        truck.total_weight = 0;
+        for (unsigned int pallet : truck.pallets)
+            truck.total_weight += weights[pallet];
+
+        solution.total_profit += truck.total_profit;
+        solution.total_weight += truck.total_weight;
+        solution.pallet_count += truck.pallets.size();
+    }
+
+    return solution;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file MultipleKnapsack.h
+ * @brief Header for the multi-truck fleet solver (multiple knapsack problem)
+ */
+
+#ifndef MULTIPLEKNAPSACK_H
+#define MULTIPLEKNAPSACK_H
+
+#include <vector>
+
+/**
+ * @brief Largest pallets × capacity product for which a truck subproblem is solved exactly by DP;
+ *        bigger subproblems fall back to a ratio greedy fill
+ */
+const unsigned long long MULTI_TRUCK_DP_CELL_LIMIT = 1ull << 28;
+
+/**
+ * @brief Maximum number of improvement rounds after the greedy construction
+ */
+const unsigned int MULTI_TRUCK_MAX_ROUNDS = 50;
+
+/**
+ * @brief Load of one truck in a fleet solution
+ * @var TruckLoad::capacity Truck's maximum weight capacity
+ * @var TruckLoad::total_profit Total profit of the pallets on the truck
+ * @var TruckLoad::total_weight Total weight of the pallets on the truck
+ * @var TruckLoad::pallets Indices of the pallets on the truck, ascending
+ */
+struct TruckLoad
+{
+    unsigned int capacity;
+    unsigned int total_profit;
+    unsigned int total_weight;
+    std::vector<unsigned int> pallets;
+};
+
+/**
+ * @brief Structure to hold a fleet solution
+ * @var FleetSol::total_profit Total profit over all trucks
+ * @var FleetSol::total_weight Total weight over all trucks
+ * @var FleetSol::pallet_count Number of pallets loaded on some truck
+ * @var FleetSol::assigned_truck Truck of each pallet (index into trucks), -1 if not loaded
+ * @var FleetSol::trucks Per-truck loads, in the order of the input capacities
+ * @var FleetSol::upper_bound Surrogate relaxation bound on the total profit
+ * @var FleetSol::rounds Number of improvement rounds performed
+ */
+struct FleetSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<int> assigned_truck;
+    std::vector<TruckLoad> trucks;
+    unsigned long long upper_bound;
+    unsigned int rounds;
+};
+
+/**
+ * @brief Surrogate relaxation bound for the multiple knapsack problem
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param capacities Truck capacities
+ * @return Upper bound on the total profit of any assignment
+ * @note With equal surrogate multipliers all trucks merge into one knapsack whose capacity is
+ *       the fleet total (pallets heavier than the largest truck are left out); its LP
+ *       relaxation (Dantzig bound) is returned.
+ * @note Time Complexity: O(n log n)
+ */
+unsigned long long fleetSurrogateBound(const unsigned int profits[], const unsigned int weights[],
+                                       unsigned int n, const std::vector<unsigned int> &capacities);
+
+/**
+ * @brief Assigns pallets to a fleet of trucks, maximizing the total profit
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param capacities Truck capacities (one per truck)
+ * @param threads Number of threads for the per-truck subproblems (0 uses the hardware concurrency)
+ * @return FleetSol with the per-truck loads, the total and the surrogate bound
+ * @note Greedy construction: trucks are filled from largest to smallest, each one solved as a
+ *       single knapsack over the pallets still unassigned.
+ * @note Improvement loop: every round re-solves, in parallel, each truck over its own pallets
+ *       plus the unassigned ones, and each pair of neighbouring trucks over their joint pallets
+ *       plus the unassigned ones; non-conflicting improvements are applied by decreasing gain.
+ *       It stops when a round finds no improvement, the bound is reached or
+ *       MULTI_TRUCK_MAX_ROUNDS rounds have run.
+ * @note Truck subproblems are solved exactly by DP when pallets × capacity is at most
+ *       MULTI_TRUCK_DP_CELL_LIMIT, otherwise by a ratio greedy fill.
+ * @note Not guaranteed to be optimal; optimality is proven when the bound is reached.
+ * @note Time Complexity: O(rounds × m × n × W / threads) with DP subproblems
+ * @note Space Complexity: O(n × W) bits per running subproblem
+ */
+FleetSol knapsackMultipleTrucks(const unsigned int profits[], const unsigned int weights[],
+                                unsigned int n, const std::vector<unsigned int> &capacities,
+                                unsigned int threads = 0);
+
+#endif // MULTIPLEKNAPSACK_H
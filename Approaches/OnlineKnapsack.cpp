@@ -0,0 +1,65 @@
+#include "OnlineKnapsack.h"
+
+OnlineKnapsack::OnlineKnapsack(unsigned int capacity)
+    : capacity(capacity), best(capacity + 1, 0), count(capacity + 1, 0), indexSum(capacity + 1, 0),
+      rowWords((static_cast<size_t>(capacity) + 64) / 64)
+{
+}
+
+void OnlineKnapsack::addPallet(unsigned int pallet, unsigned int weight, unsigned int profit)
+{
+    unsigned int index = pallets.size();
+    pallets.push_back(pallet);
+    weights.push_back(weight);
+    profits.push_back(profit);
+
+    size_t rowStart = takeBits.size();
+    takeBits.resize(rowStart + rowWords, 0);
+    if (weight > capacity)
+        return;
+
+    // descending capacities: best[w - weight] still holds the row before this pallet
+    for (unsigned int w = capacity;; w--)
+    {
+        unsigned int valueWithItem = best[w - weight] + profit;
+        unsigned int countWithItem = count[w - weight] + 1;
+        unsigned long long indexSumWithItem = indexSum[w - weight] + index;
+
+        bool take = valueWithItem > best[w] ||
+                    (valueWithItem == best[w] &&
+                     (countWithItem < count[w] ||
+                      (countWithItem == count[w] && indexSumWithItem < indexSum[w])));
+        if (take)
+        {
+            best[w] = valueWithItem;
+            count[w] = countWithItem;
+            indexSum[w] = indexSumWithItem;
+            takeBits[rowStart + w / 64] |= uint64_t(1) << (w % 64);
+        }
+
+        if (w == weight)
+            break;
+    }
+}
+
+OnlineSol OnlineKnapsack::solutionAt(unsigned int w) const
+{
+    OnlineSol result;
+    result.total_profit = best[w];
+    result.total_weight = 0;
+    result.pallet_count = 0;
+    result.used_pallets.assign(pallets.size(), false);
+
+    // walk the arrivals backwards, following the take bit at the remaining capacity
+    for (size_t i = pallets.size(); i-- > 0;)
+    {
+        if (takeBits[i * rowWords + w / 64] >> (w % 64) & 1)
+        {
+            result.used_pallets[i] = true;
+            result.total_weight += weights[i];
+            result.pallet_count++;
+            w -= weights[i];
+        }
+    }
+    return result;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file OnlineKnapsack.h
+ * @brief Incremental dynamic programming for pallets that arrive one at a time
+ */
+
+#ifndef ONLINEKNAPSACK_H
+#define ONLINEKNAPSACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Structure to hold the current optimum of the online solver
+ * @var OnlineSol::total_profit Total profit of selected pallets
+ * @var OnlineSol::total_weight Total weight of selected pallets
+ * @var OnlineSol::pallet_count Number of pallets selected
+ * @var OnlineSol::used_pallets Boolean vector indicating which of the arrived pallets are used
+ */
+struct OnlineSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+};
+
+/**
+ * @brief 0/1 knapsack solver whose DP state is extended by one row per arriving pallet
+ *
+ * Keeps a single DP row over capacities 0..W (best profit, pallet count and index sum, with
+ * the same tie-breaking as knapsackDP) and updates it in place when a pallet arrives, so the
+ * optimum for the configured capacity is known after every arrival without re-solving.
+ * For each pallet one bit per capacity records whether it was taken, which is enough to
+ * rebuild the selected pallets on demand.
+ *
+ * @var OnlineKnapsack::capacity Truck capacity the optimum is maintained for
+ * @var OnlineKnapsack::best Best profit for every capacity 0..W over the pallets so far
+ * @var OnlineKnapsack::count Pallet count of those solutions (tie-break)
+ * @var OnlineKnapsack::indexSum Sum of the arrival indices of those solutions (tie-break)
+ * @var OnlineKnapsack::takeBits One row of (W + 1) bits per pallet: taken at that capacity
+ * @var OnlineKnapsack::rowWords Number of 64-bit words in a takeBits row
+ * @var OnlineKnapsack::pallets IDs of the pallets received so far
+ * @var OnlineKnapsack::weights Weights of the pallets received so far
+ * @var OnlineKnapsack::profits Profits of the pallets received so far
+ */
+class OnlineKnapsack
+{
+private:
+    unsigned int capacity;
+    std::vector<unsigned int> best;
+    std::vector<unsigned int> count;
+    std::vector<unsigned long long> indexSum;
+    std::vector<uint64_t> takeBits;
+    size_t rowWords;
+    std::vector<unsigned int> pallets;
+    std::vector<unsigned int> weights;
+    std::vector<unsigned int> profits;
+
+public:
+    /**
+     * @brief Creates an empty solver for a truck capacity
+     * @param capacity Maximum weight capacity of the truck
+     */
+    explicit OnlineKnapsack(unsigned int capacity);
+
+    /**
+     * @brief Adds one pallet and updates the DP row
+     * @param pallet Pallet ID
+     * @param weight Pallet weight
+     * @param profit Pallet profit value
+     * @note Time Complexity: O(W)
+     * @note Space Complexity: O(W) bits per pallet for the selection
+     */
+    void addPallet(unsigned int pallet, unsigned int weight, unsigned int profit);
+
+    /**
+     * @brief Best profit for the configured capacity over the pallets received so far
+     * @return The optimal profit
+     * @note Time Complexity: O(1)
+     */
+    unsigned int bestProfit() const { return best[capacity]; }
+
+    /**
+     * @brief Number of pallets in the current optimum
+     * @return Pallet count
+     * @note Time Complexity: O(1)
+     */
+    unsigned int bestPalletCount() const { return count[capacity]; }
+
+    /**
+     * @brief Best profit for any capacity up to the configured one
+     * @param w Capacity to query (at most truckCapacity())
+     * @return The optimal profit for a truck of capacity w
+     * @note Time Complexity: O(1)
+     */
+    unsigned int bestProfitAt(unsigned int w) const { return best[w]; }
+
+    /**
+     * @brief Best profit for every capacity 0..W
+     * @return The DP row, indexed by capacity
+     */
+    const std::vector<unsigned int> &profitCurve() const { return best; }
+
+    /**
+     * @brief Rebuilds the current optimal selection
+     * @return The optimum over the pallets received so far
+     * @note Time Complexity: O(n)
+     */
+    OnlineSol solution() const { return solutionAt(capacity); }
+
+    /**
+     * @brief Rebuilds the optimal selection for a smaller capacity
+     * @param w Capacity to query (at most truckCapacity())
+     * @return The optimum for a truck of capacity w over the pallets received so far
+     * @note Time Complexity: O(n)
+     */
+    OnlineSol solutionAt(unsigned int w) const;
+
+    /**
+     * @brief Number of pallets received so far
+     * @return Pallet count
+     */
+    unsigned int size() const { return pallets.size(); }
+
+    /**
+     * @brief Truck capacity the optimum is maintained for
+     * @return Capacity
+     */
+    unsigned int truckCapacity() const { return capacity; }
+
+    /**
+     * @brief IDs of the pallets received so far, in arrival order
+     * @return Pallet IDs
+     */
+    const std::vector<unsigned int> &palletIds() const { return pallets; }
+
+    /**
+     * @brief Weights of the pallets received so far, in arrival order
+     * @return Pallet weights
+     */
+    const std::vector<unsigned int> &palletWeights() const { return weights; }
+
+    /**
+     * @brief Profits of the pallets received so far, in arrival order
+     * @return Pallet profits
+     */
+    const std::vector<unsigned int> &palletProfits() const { return profits; }
+};
+
+#endif // ONLINEKNAPSACK_H
@@ -0,0 +1,92 @@
+#include "Portfolio.h"
+#include "DynamicProgramming.h"
+#include "IntegerProgramming.h"
+#include "MeetInTheMiddle.h"
+#include "SolverRegistry.h"
+#include <functional>
+#include <memory>
+#include <stop_token>
+#include <thread>
+
+// one racer: its registry name and how it solves, giving up when the stop source says so
+struct Racer
+{
+    std::string name;
+    std::function<PortfolioSol(std::stop_source)> solve;
+};
+
+// copies a solver's selection into a portfolio solution
+template <typename Solution>
+static PortfolioSol fromSolution(const Solution &solution)
+{
+    return {solution.total_profit, solution.total_weight, solution.pallet_count, solution.used_pallets, "", {}};
+}
+
+PortfolioSol knapsackPortfolio(const unsigned int profits[], const unsigned int weights[],
+                               unsigned int n, unsigned int max_weight, unsigned int max_pallets)
+{
+    std::vector<Racer> racers;
+
+    bool dpFits = max_pallets == 0 ? (n + 1ull) * (max_weight + 1ull) <= REGISTRY_DP_CELL_LIMIT
+                                   : knapsackDPCardinalityFits(weights, n, max_weight, max_pallets);
+    if (dpFits)
+    {
+        racers.push_back({"dp", [=](std::stop_source stop)
+        {
+            std::unique_ptr<bool[]> usedItems(new bool[n]());
+            unsigned int profit = max_pallets == 0
+                                      ? knapsackDP(profits, weights, n, max_weight, usedItems.get(), stop)
+                                      : knapsackDPCardinality(profits, weights, n, max_weight, max_pallets,
+                                                              usedItems.get(), stop);
+            PortfolioSol solution = {profit, 0, 0, std::vector<bool>(usedItems.get(), usedItems.get() + n), "", {}};
+            for (unsigned int i = 0; i < n; i++)
+            {
+                if (usedItems[i])
+                {
+                    solution.total_weight += weights[i];
+                    solution.pallet_count++;
+                }
+            }
+            return solution;
+        }});
+    }
+    racers.push_back({"bb", [=](std::stop_source stop)
+    {
+        return fromSolution(knapsackBranchAndBound(profits, weights, n, max_weight, max_pallets, stop));
+    }});
+    if (max_pallets == 0 && n <= MITM_MAX_PALLETS)
+    {
+        racers.push_back({"mitm", [=](std::stop_source stop)
+        {
+            return fromSolution(knapsackMeetInTheMiddle(profits, weights, n, max_weight, stop));
+        }});
+    }
+
+    // every racer writes only its own slot, and the winner is read after the threads are joined
+    std::stop_source stop;
+    std::vector<PortfolioSol> results(racers.size());
+    size_t winner = racers.size();
+    {
+        std::vector<std::jthread> threads;
+        for (size_t k = 0; k < racers.size(); k++)
+        {
+            threads.emplace_back([&, k]
+            {
+                results[k] = racers[k].solve(stop);
+                // only the first stop request succeeds: a racer that was stopped, or saw Esc, never wins
+                if (stop.request_stop())
+                    winner = k;
+            });
+        }
+    }
+
+    PortfolioSol solution = {0, 0, 0, std::vector<bool>(n, false), "", {}};
+    if (winner < racers.size())
+    {
+        solution = std::move(results[winner]);
+        solution.winner = racers[winner].name;
+    }
+    for (const Racer &racer : racers)
+        solution.racers.push_back(racer.name);
+    return solution;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file Portfolio.h
+ * @brief Header for the solver portfolio: exact solvers racing on one instance, first to finish wins
+ */
+
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+#include <string>
+#include <vector>
+
+/**
+ * @brief Structure to hold pallet loading solution for the portfolio
+ * @var PortfolioSol::total_profit Total profit of selected pallets
+ * @var PortfolioSol::total_weight Total weight of selected pallets
+ * @var PortfolioSol::pallet_count Number of pallets selected
+ * @var PortfolioSol::used_pallets Boolean vector indicating which pallets are used
+ * @var PortfolioSol::winner Registry name of the solver that finished first (empty if cancelled)
+ * @var PortfolioSol::racers Registry names of every solver that was started
+ */
+struct PortfolioSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+    std::string winner;
+    std::vector<std::string> racers;
+};
+
+/**
+ * @brief Races the exact solvers that apply and keeps the first optimal loading
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_pallets Maximum number of pallets on the truck (0 for no limit)
+ * @return PortfolioSol containing an optimal loading, or an empty loading with no winner when
+ *         Esc was pressed
+ * @note Dynamic programming (when its table fits), branch-and-bound and, for at most
+ *       MITM_MAX_PALLETS pallets without a pallet limit, meet-in-the-middle each run on their own
+ *       thread over the same read-only arrays. They share one std::stop_source: the first to
+ *       finish requests a stop and the others give up at their next check.
+ * @note Time Complexity: that of the fastest racer on this instance, plus the time the others
+ *       take to notice the stop
+ * @note Space Complexity: the sum of the racers' memory, all held at once
+ */
+PortfolioSol knapsackPortfolio(const unsigned int profits[], const unsigned int weights[],
+                               unsigned int n, unsigned int max_weight, unsigned int max_pallets = 0);
+
+#endif // PORTFOLIO_H
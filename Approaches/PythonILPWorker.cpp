@@ -0,0 +1,229 @@
+#include "PythonILPWorker.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sstream>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+// first look for the script next to the executable's working directory, then in the sources
+static const char *SCRIPT_LOCATIONS[] = {"knapsack_solver.py", "../Approaches/knapsack_solver.py"};
+
+// writes the whole string; a dead worker makes this fail with EPIPE instead of killing us with
+// SIGPIPE, which is blocked on this thread for the write only (pipes have no MSG_NOSIGNAL)
+static bool writeAll(int fd, const std::string &data)
+{
+    sigset_t pipeSignal, previousMask, pending;
+    sigemptyset(&pipeSignal);
+    sigaddset(&pipeSignal, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+    sigpending(&pending);
+    bool alreadyPending = sigismember(&pending, SIGPIPE);
+
+    size_t written = 0;
+    bool ok = true;
+    while (written < data.size())
+    {
+        ssize_t result = write(fd, data.data() + written, data.size() - written);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            ok = false;
+            break;
+        }
+        written += result;
+    }
+
+    // swallow the SIGPIPE our own write raised, so it is not delivered once unblocked
+    if (!ok && errno == EPIPE && !alreadyPending)
+    {
+        const timespec noWait = {0, 0};
+        while (sigtimedwait(&pipeSignal, nullptr, &noWait) < 0 && errno == EINTR)
+        {
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+    return ok;
+}
+
+static bool readLine(FILE *stream, std::string &line)
+{
+    line.clear();
+    int ch;
+    while ((ch = fgetc(stream)) != EOF)
+    {
+        if (ch == '\n')
+            return true;
+        line.push_back(static_cast<char>(ch));
+    }
+    return !line.empty();
+}
+
+PythonILPWorker::PythonILPWorker() : pid(-1), toWorker(-1), fromWorker(nullptr) {}
+
+PythonILPWorker::~PythonILPWorker()
+{
+    stop();
+}
+
+bool PythonILPWorker::isRunning() const
+{
+    return pid > 0;
+}
+
+bool PythonILPWorker::start()
+{
+    const char *script = nullptr;
+    for (const char *location : SCRIPT_LOCATIONS)
+    {
+        if (access(location, R_OK) == 0)
+        {
+            script = location;
+            break;
+        }
+    }
+    if (script == nullptr)
+    {
+        return false;
+    }
+
+    int input[2], output[2];
+    if (pipe(input) != 0)
+    {
+        return false;
+    }
+    if (pipe(output) != 0)
+    {
+        close(input[0]);
+        close(input[1]);
+        return false;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, input[0], STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addclose(&actions, input[0]);
+    posix_spawn_file_actions_addclose(&actions, input[1]);
+    posix_spawn_file_actions_addclose(&actions, output[0]);
+    posix_spawn_file_actions_addclose(&actions, output[1]);
+
+    char *argv[] = {const_cast<char *>("python3"), const_cast<char *>("-u"),
+                    const_cast<char *>(script), const_cast<char *>("--worker"), nullptr};
+    pid_t child;
+    int spawnError = posix_spawnp(&child, "python3", &actions, nullptr, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+
+    close(input[0]);
+    close(output[1]);
+    if (spawnError != 0)
+    {
+        close(input[1]);
+        close(output[0]);
+        return false;
+    }
+
+    // keep our ends out of any later child processes
+    fcntl(input[1], F_SETFD, FD_CLOEXEC);
+    fcntl(output[0], F_SETFD, FD_CLOEXEC);
+
+    FILE *stream = fdopen(output[0], "r");
+    if (stream == nullptr)
+    {
+        // closing its stdin makes the script exit
+        close(input[1]);
+        close(output[0]);
+        while (waitpid(child, nullptr, 0) < 0 && errno == EINTR)
+        {
+        }
+        return false;
+    }
+
+    pid = child;
+    toWorker = input[1];
+    fromWorker = stream;
+    return true;
+}
+
+void PythonILPWorker::stop()
+{
+    if (pid <= 0)
+    {
+        return;
+    }
+    // EOF on stdin ends the worker loop
+    close(toWorker);
+    fclose(fromWorker);
+    int status;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+    {
+    }
+    pid = -1;
+    toWorker = -1;
+    fromWorker = nullptr;
+}
+
+bool PythonILPWorker::solve(const unsigned int profits[], const unsigned int weights[],
+                            unsigned int n, unsigned int max_weight, ILPSol &solution)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    solution = {0, 0, 0, std::vector<bool>(n, false), 0, 0, "PuLP (CBC via Python)"};
+
+    if (!isRunning() && !start())
+    {
+        return false;
+    }
+
+    std::ostringstream request;
+    request << n << "\n"
+            << max_weight << "\n";
+    for (unsigned int i = 0; i < n; i++)
+        request << weights[i] << " ";
+    request << "\n";
+    for (unsigned int i = 0; i < n; i++)
+        request << profits[i] << " ";
+    request << "\n";
+
+    std::string profitLine, weightLine, indicesLine;
+    bool ok = writeAll(toWorker, request.str()) &&
+              readLine(fromWorker, profitLine) &&
+              readLine(fromWorker, weightLine) &&
+              readLine(fromWorker, indicesLine);
+    if (!ok || profitLine.empty())
+    {
+        // the script died (no python3, no PuLP, ...); start a fresh one next time
+        stop();
+        return false;
+    }
+
+    solution.total_profit = std::strtoul(profitLine.c_str(), nullptr, 10);
+    solution.total_weight = std::strtoul(weightLine.c_str(), nullptr, 10);
+
+    std::istringstream iss(indicesLine);
+    unsigned int index;
+    while (iss >> index)
+    {
+        // indices are 0-based
+        if (index < n)
+        {
+            solution.used_pallets[index] = true;
+            solution.pallet_count++;
+        }
+    }
+
+    return true;
+}
+
+PythonILPWorker &sharedPythonILPWorker()
+{
+    static PythonILPWorker worker;
+    return worker;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file PythonILPWorker.h
+ * @brief Pipe-based connection to the PuLP solver script (knapsack_solver.py)
+ */
+
+#ifndef PYTHONILPWORKER_H
+#define PYTHONILPWORKER_H
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include "IntegerProgramming.h"
+
+/**
+ * @brief A knapsack_solver.py process started with posix_spawn and driven through its stdin/stdout
+ *
+ * The script runs in --worker mode and answers one instance per request with the same line
+ * format it uses for files (n, capacity, weights, profits in; profit, weight, indices out), so
+ * no files are written and concurrent runs in one directory cannot clobber each other.
+ * A worker can be kept alive for a whole session so the interpreter and PuLP start only once.
+ *
+ * @var PythonILPWorker::pid Process ID of the script, -1 when not running
+ * @var PythonILPWorker::toWorker Write end of the pipe connected to the script's stdin
+ * @var PythonILPWorker::fromWorker Read end of the pipe connected to the script's stdout
+ * @var PythonILPWorker::mutex Serialises requests, since the line protocol has no request IDs
+ */
+class PythonILPWorker
+{
+private:
+    pid_t pid;
+    int toWorker;
+    FILE *fromWorker;
+    std::mutex mutex;
+
+    bool start();
+    void stop();
+
+public:
+    PythonILPWorker();
+
+    /**
+     * @brief Closes the script's stdin, which makes it exit, and waits for it
+     */
+    ~PythonILPWorker();
+
+    PythonILPWorker(const PythonILPWorker &) = delete;
+    PythonILPWorker &operator=(const PythonILPWorker &) = delete;
+
+    /**
+     * @brief Sends one instance to the script and reads back its solution
+     * @param profits Array of profit values for each pallet
+     * @param weights Array of weight values for each pallet
+     * @param n Number of pallets
+     * @param max_weight Maximum weight capacity of truck
+     * @param solution Output solution, filled in on success
+     * @return true on success; false if python3, PuLP or the script is unavailable or the script died
+     * @note Starts the script on first use and again after a failure
+     */
+    bool solve(const unsigned int profits[], const unsigned int weights[],
+               unsigned int n, unsigned int max_weight, ILPSol &solution);
+
+    /**
+     * @brief Checks whether the script process is currently running
+     * @return true if a process is attached to this worker
+     */
+    bool isRunning() const;
+};
+
+/**
+ * @brief Session-wide persistent worker, started on first use and stopped at program exit
+ * @return Reference to the shared worker
+ */
+PythonILPWorker &sharedPythonILPWorker();
+
+#endif // PYTHONILPWORKER_H
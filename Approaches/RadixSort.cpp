@@ -0,0 +1,131 @@
+#include "RadixSort.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <thread>
+
+// below this many pallets per thread the thread start-up costs more than it saves
+static const unsigned int MIN_CHUNK_PER_THREAD = 16384;
+
+unsigned long long ratioKey(unsigned int profit, unsigned int weight)
+{
+    if (weight == 0)
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+    return (static_cast<unsigned long long>(profit) << 32) / weight;
+}
+
+// runs task(t) for t in [0, threads), the last one on the calling thread
+template <typename Task>
+static void runOnThreads(unsigned int threads, Task task)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned int t = 0; t + 1 < threads; t++)
+    {
+        workers.emplace_back(task, t);
+    }
+    task(threads - 1);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+template <typename Key>
+static std::vector<unsigned int> radixSortImpl(const Key keys[], unsigned int n, unsigned int threads)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::max(1u, std::min(threads, n / MIN_CHUNK_PER_THREAD));
+
+    // keys are complemented so that an ascending stable sort gives descending keys
+    // while equal keys keep their ascending index order
+    std::vector<Key> keysIn(n), keysOut(n);
+    std::vector<unsigned int> indexIn(n), indexOut(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        keysIn[i] = ~keys[i];
+        indexIn[i] = i;
+    }
+
+    unsigned int chunk = (n + threads - 1) / std::max(1u, threads);
+    std::vector<std::array<unsigned int, 256>> histograms(threads);
+
+    for (unsigned int shift = 0; shift < sizeof(Key) * 8; shift += 8)
+    {
+        // per-thread histogram of the current digit
+        runOnThreads(threads, [&](unsigned int t)
+                     {
+                         std::array<unsigned int, 256> &hist = histograms[t];
+                         hist.fill(0);
+                         unsigned int begin = std::min(n, t * chunk);
+                         unsigned int end = std::min(n, begin + chunk);
+                         for (unsigned int i = begin; i < end; i++)
+                         {
+                             hist[(keysIn[i] >> shift) & 0xFF]++;
+                         }
+                     });
+
+        // skip digits that are the same for every key
+        bool trivialPass = false;
+        for (unsigned int b = 0; b < 256 && !trivialPass; b++)
+        {
+            unsigned int total = 0;
+            for (unsigned int t = 0; t < threads; t++)
+            {
+                total += histograms[t][b];
+            }
+            trivialPass = (total == n);
+        }
+        if (trivialPass)
+        {
+            continue;
+        }
+
+        // turn the counts into scatter offsets, digit-major then thread-minor to stay stable
+        unsigned int offset = 0;
+        for (unsigned int b = 0; b < 256; b++)
+        {
+            for (unsigned int t = 0; t < threads; t++)
+            {
+                unsigned int count = histograms[t][b];
+                histograms[t][b] = offset;
+                offset += count;
+            }
+        }
+
+        runOnThreads(threads, [&](unsigned int t)
+                     {
+                         std::array<unsigned int, 256> &next = histograms[t];
+                         unsigned int begin = std::min(n, t * chunk);
+                         unsigned int end = std::min(n, begin + chunk);
+                         for (unsigned int i = begin; i < end; i++)
+                         {
+                             unsigned int pos = next[(keysIn[i] >> shift) & 0xFF]++;
+                             keysOut[pos] = keysIn[i];
+                             indexOut[pos] = indexIn[i];
+                         }
+                     });
+
+        keysIn.swap(keysOut);
+        indexIn.swap(indexOut);
+    }
+
+    return indexIn;
+}
+
+std::vector<unsigned int> radixSortDescending(const unsigned int keys[], unsigned int n,
+                                              unsigned int threads)
+{
+    return radixSortImpl(keys, n, threads);
+}
+
+std::vector<unsigned int> radixSortDescending(const unsigned long long keys[], unsigned int n,
+                                              unsigned int threads)
+{
+    return radixSortImpl(keys, n, threads);
+}
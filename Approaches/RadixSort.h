@@ -0,0 +1,67 @@
+/**
+ * @file RadixSort.h
+ * @brief Multithreaded LSD radix sort used to order pallets on large manifests
+ */
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <vector>
+
+/**
+ * @brief Number of pallets from which the greedy approaches use radix sort instead of std::sort
+ */
+const unsigned int RADIX_SORT_THRESHOLD = 65536;
+
+/**
+ * @brief Builds a fixed-point (32.32) key for the profit-to-weight ratio of a pallet
+ * @param profit Profit value of the pallet
+ * @param weight Weight value of the pallet
+ * @return floor(profit × 2^32 / weight), or the largest key when the weight is 0
+ * @note Ratios that differ by less than 2^-32 map to the same key and are ordered by index
+ */
+unsigned long long ratioKey(unsigned int profit, unsigned int weight);
+
+/**
+ * @brief Exact "better profit-to-weight ratio" test, a strict weak ordering on pallets
+ * @param profitA Profit value of the first pallet
+ * @param weightA Weight value of the first pallet
+ * @param profitB Profit value of the second pallet
+ * @param weightB Weight value of the second pallet
+ * @return true if the first pallet goes before the second in decreasing ratio order
+ * @note Zero-weight pallets come before every other pallet and tie among themselves: a bare
+ *       cross-multiplication would make a zero-weight, zero-profit pallet tie with everything,
+ *       which is not an ordering and breaks the sorts and LP bounds built on it.
+ */
+inline bool ratioBefore(unsigned int profitA, unsigned int weightA, unsigned int profitB, unsigned int weightB)
+{
+    if (weightA == 0 || weightB == 0)
+        return weightA == 0 && weightB != 0;
+    return static_cast<unsigned long long>(profitA) * weightB > static_cast<unsigned long long>(profitB) * weightA;
+}
+
+/**
+ * @brief Orders pallet indices by 32-bit key in descending order
+ * @param keys Array of keys (e.g. profit values), one per pallet
+ * @param n Number of pallets
+ * @param threads Number of worker threads (0 uses the hardware concurrency)
+ * @return Pallet indices sorted by descending key; equal keys keep ascending index order
+ * @note Time Complexity: O(n) per 8-bit digit, 4 digits; digits shared by all keys are skipped
+ * @note Space Complexity: O(n + threads × 256) for the ping-pong buffers and per-thread histograms
+ */
+std::vector<unsigned int> radixSortDescending(const unsigned int keys[], unsigned int n,
+                                              unsigned int threads = 0);
+
+/**
+ * @brief Orders pallet indices by 64-bit key in descending order
+ * @param keys Array of keys (e.g. fixed-point ratios from ratioKey), one per pallet
+ * @param n Number of pallets
+ * @param threads Number of worker threads (0 uses the hardware concurrency)
+ * @return Pallet indices sorted by descending key; equal keys keep ascending index order
+ * @note Time Complexity: O(n) per 8-bit digit, 8 digits; digits shared by all keys are skipped
+ * @note Space Complexity: O(n + threads × 256) for the ping-pong buffers and per-thread histograms
+ */
+std::vector<unsigned int> radixSortDescending(const unsigned long long keys[], unsigned int n,
+                                              unsigned int threads = 0);
+
+#endif // RADIXSORT_H
@@ -0,0 +1,284 @@
+#include "SolverRegistry.h"
+#include "Exhaustive.h"
+#include "DynamicProgramming.h"
+#include "Backtracking.h"
+#include "Greedy.h"
+#include "LocalSearch.h"
+#include "Metaheuristic.h"
+#include "IntegerProgramming.h"
+#include "TwoDimensional.h"
+#include "MeetInTheMiddle.h"
+#include "CoreKnapsack.h"
+#include "SolverSelection.h"
+#include "Portfolio.h"
+#include "../Utils/Timing.h"
+#include <memory>
+
+// copies a solver's selection into the result
+template <typename Solution>
+static void takeSelection(const Solution &solution, SolverResult &result)
+{
+    result.ran = true;
+    result.total_profit = solution.total_profit;
+    result.total_weight = solution.total_weight;
+    result.pallet_count = solution.pallet_count;
+    result.used_pallets = solution.used_pallets;
+}
+
+static void runExhaustive(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    if (instance.n > REGISTRY_EXHAUSTIVE_MAX_PALLETS)
+    {
+        result.message = "more than " + std::to_string(REGISTRY_EXHAUSTIVE_MAX_PALLETS) + " pallets";
+        return;
+    }
+    takeSelection(knapsackBF(instance.profits, instance.weights, instance.n, instance.capacity,
+                             instance.max_pallets), result);
+    result.optimal = true;
+}
+
+static void runDynamicProgramming(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    const unsigned int *weights = instance.weights;
+    unsigned int n = instance.n;
+    if (instance.max_pallets != 0 && !knapsackDPCardinalityFits(weights, n, instance.capacity, instance.max_pallets))
+    {
+        result.message = "pallets x limit x capacity table too large";
+        return;
+    }
+    if (instance.max_pallets == 0 && (n + 1ull) * (instance.capacity + 1ull) > REGISTRY_DP_CELL_LIMIT)
+    {
+        result.message = "pallets x capacity table too large";
+        return;
+    }
+
+    std::unique_ptr<bool[]> usedItems(new bool[n]());
+    result.total_profit = instance.max_pallets == 0
+                              ? knapsackDP(instance.profits, weights, n, instance.capacity, usedItems.get())
+                              : knapsackDPCardinality(instance.profits, weights, n, instance.capacity,
+                                                      instance.max_pallets, usedItems.get());
+    result.ran = true;
+    result.optimal = true;
+    result.used_pallets.assign(usedItems.get(), usedItems.get() + n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (usedItems[i])
+        {
+            result.total_weight += weights[i];
+            result.pallet_count++;
+        }
+    }
+}
+
+static void runBacktracking(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    takeSelection(knapsackBT(instance.profits, instance.weights, instance.n, instance.capacity,
+                             instance.max_pallets), result);
+    result.optimal = true;
+}
+
+static void runGreedyRatio(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    takeSelection(knapsackGreedyRatio(instance.profits, instance.weights, instance.n, instance.capacity,
+                                      instance.max_pallets), result);
+}
+
+static void runGreedyProfit(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    takeSelection(knapsackGreedyProfit(instance.profits, instance.weights, instance.n, instance.capacity,
+                                       instance.max_pallets), result);
+}
+
+static void runGreedyMaximum(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    takeSelection(knapsackGreedyMaximum(instance.profits, instance.weights, instance.n, instance.capacity,
+                                        instance.max_pallets), result);
+}
+
+static void runLocalSearch(const InstanceView &instance, const SolverOptions &options, SolverResult &result)
+{
+    GreedySol solution = knapsackGreedyMaximum(instance.profits, instance.weights, instance.n, instance.capacity,
+                                               instance.max_pallets);
+    improveGreedySolution(instance.profits, instance.weights, instance.n, instance.capacity, solution,
+                          options.time_budget_ms, instance.max_pallets);
+    takeSelection(solution, result);
+}
+
+static void runSimulatedAnnealing(const InstanceView &instance, const SolverOptions &options, SolverResult &result)
+{
+    MetaheuristicSol solution = knapsackSimulatedAnnealing(instance.profits, instance.weights, instance.n,
+                                                           instance.capacity, options.time_budget_ms,
+                                                           METAHEURISTIC_DEFAULT_TARGET_GAP, options.threads);
+    takeSelection(solution, result);
+    result.optimal = solution.total_profit == solution.upper_bound;
+}
+
+static void runBranchAndBound(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    takeSelection(knapsackBranchAndBound(instance.profits, instance.weights, instance.n, instance.capacity,
+                                         instance.max_pallets), result);
+    result.optimal = true;
+}
+
+static void runPythonILP(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    ILPSol solution;
+    if (!knapsackILPPython(instance.profits, instance.weights, instance.n, instance.capacity, solution))
+    {
+        result.message = "Python 3 with PuLP is not available";
+        return;
+    }
+    takeSelection(solution, result);
+    result.optimal = true;
+}
+
+static void runTwoDimensionalDP(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    if (instance.volumes == nullptr)
+    {
+        result.message = "the instance has no volume column";
+        return;
+    }
+    if (!twoDimDPFits(instance.weights, instance.volumes, instance.n, instance.capacity, instance.volume_capacity))
+    {
+        result.message = "pallets x weight x volume table too large";
+        return;
+    }
+    takeSelection(knapsack2DDP(instance.profits, instance.weights, instance.volumes, instance.n,
+                               instance.capacity, instance.volume_capacity), result);
+    result.optimal = true;
+}
+
+static void runTwoDimensionalBranchAndBound(const InstanceView &instance, const SolverOptions &,
+                                            SolverResult &result)
+{
+    if (instance.volumes == nullptr)
+    {
+        result.message = "the instance has no volume column";
+        return;
+    }
+    takeSelection(knapsack2DBranchAndBound(instance.profits, instance.weights, instance.volumes, instance.n,
+                                           instance.capacity, instance.volume_capacity), result);
+    result.optimal = true;
+}
+
+static void runMeetInTheMiddle(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    if (instance.n > MITM_MAX_PALLETS)
+    {
+        result.message = "more than " + std::to_string(MITM_MAX_PALLETS) + " pallets";
+        return;
+    }
+    takeSelection(knapsackMeetInTheMiddle(instance.profits, instance.weights, instance.n, instance.capacity),
+                  result);
+    result.optimal = true;
+}
+
+static void runCore(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    CoreSol solution = knapsackCore(instance.profits, instance.weights, instance.n, instance.capacity);
+    takeSelection(solution, result);
+    result.optimal = true;
+    result.message = "core of " + std::to_string(solution.core_size) + " pallets";
+}
+
+static void runPortfolio(const InstanceView &instance, const SolverOptions &, SolverResult &result)
+{
+    PortfolioSol solution = knapsackPortfolio(instance.profits, instance.weights, instance.n, instance.capacity,
+                                              instance.max_pallets);
+    takeSelection(solution, result);
+    std::string racers;
+    for (const std::string &name : solution.racers)
+        racers += (racers.empty() ? "" : ", ") + name;
+    if (solution.winner.empty())
+    {
+        result.message = "cancelled while racing " + racers;
+        return;
+    }
+    result.optimal = true;
+    result.message = solution.winner + " finished first of " + racers;
+}
+
+// a constraint the solver did not see makes its optimality claim meaningless
+static void noteIgnoredConstraints(const SolverInfo &solver, const InstanceView &instance, SolverResult &result)
+{
+    std::vector<std::string> ignored;
+    if (instance.max_pallets != 0 && !solver.enforces_pallet_limit)
+        ignored.push_back("pallet limit of " + std::to_string(instance.max_pallets));
+    if (instance.volumes != nullptr && !solver.uses_volumes)
+        ignored.push_back("volumes");
+    for (size_t k = 0; k < ignored.size(); k++)
+    {
+        result.message += (k == 0 ? (result.message.empty() ? "ignores " : "; ignores ") : " and ") + ignored[k];
+        result.optimal = false;
+    }
+}
+
+static void runAutomatic(const InstanceView &instance, const SolverOptions &options, SolverResult &result)
+{
+    SolverChoice choice = chooseSolver(instance, options.time_budget_ms, activeCostModel());
+    const SolverInfo &chosen = *findSolver(choice.solver);
+    chosen.run(instance, options, result);
+    noteIgnoredConstraints(chosen, instance, result);
+    result.message = "chose " + choice.solver + " (" + choice.reason + ")" +
+                     (result.message.empty() ? "" : "; " + result.message);
+}
+
+const std::vector<SolverInfo> &solverRegistry()
+{
+    static const std::vector<SolverInfo> registry = {
+        {"bf", "Exhaustive Search", true, true, false, runExhaustive},
+        {"dp", "Dynamic Programming", true, true, false, runDynamicProgramming},
+        {"bt", "Backtracking", true, true, false, runBacktracking},
+        {"greedy-ratio", "Greedy Ratio", false, true, false, runGreedyRatio},
+        {"greedy-profit", "Greedy Profit", false, true, false, runGreedyProfit},
+        {"greedy", "Greedy Maximum", false, true, false, runGreedyMaximum},
+        {"local-search", "Greedy + Local Search", false, true, false, runLocalSearch},
+        {"sa", "Simulated Annealing", false, false, false, runSimulatedAnnealing},
+        {"bb", "Integer LP (native Branch-and-Bound)", true, true, false, runBranchAndBound},
+        {"ilp-python", "Integer LP (PuLP/CBC)", true, false, false, runPythonILP},
+        {"dp2d", "Weight + Volume Dynamic Programming", true, false, true, runTwoDimensionalDP},
+        {"bb2d", "Weight + Volume Branch-and-Bound", true, false, true, runTwoDimensionalBranchAndBound},
+        {"mitm", "Meet-in-the-Middle", true, false, false, runMeetInTheMiddle},
+        {"core", "Core (reduction around the break item)", true, false, false, runCore},
+        {"auto", "Automatic (cost-model choice)", false, true, true, runAutomatic},
+        {"portfolio", "Portfolio (DP, Branch-and-Bound and Meet-in-the-Middle racing)", true, true, false, runPortfolio},
+    };
+    return registry;
+}
+
+const SolverInfo *findSolver(const std::string &name)
+{
+    for (const SolverInfo &solver : solverRegistry())
+    {
+        if (name == solver.name)
+            return &solver;
+    }
+    return nullptr;
+}
+
+SolverResult runSolver(const SolverInfo &solver, const InstanceView &instance, const SolverOptions &options)
+{
+    SolverResult result;
+    result.solver = solver.name;
+
+    TimingSample time = timeCall([&] { solver.run(instance, options, result); });
+    result.elapsed_ms = time.wall_ms;
+    result.user_ms = time.user_ms;
+    result.sys_ms = time.sys_ms;
+
+    if (!result.ran)
+        return result;
+
+    if (instance.volumes != nullptr)
+    {
+        for (unsigned int i = 0; i < instance.n; i++)
+        {
+            if (result.used_pallets[i])
+                result.total_volume += instance.volumes[i];
+        }
+    }
+
+    noteIgnoredConstraints(solver, instance, result);
+    return result;
+}
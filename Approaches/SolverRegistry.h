@@ -0,0 +1,110 @@
+/**
+ * @file SolverRegistry.h
+ * @brief Table of the single-truck solvers, callable by name from non-interactive front ends
+ */
+
+#ifndef SOLVERREGISTRY_H
+#define SOLVERREGISTRY_H
+
+#include <string>
+#include <vector>
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Largest number of pallets the exhaustive search is started on (2^n subsets)
+ */
+const unsigned int REGISTRY_EXHAUSTIVE_MAX_PALLETS = 30;
+
+/**
+ * @brief Largest (n + 1) × (capacity + 1) table knapsackDP is started on (three such tables are kept)
+ */
+const unsigned long long REGISTRY_DP_CELL_LIMIT = 1ull << 25;
+
+/**
+ * @brief Settings shared by every registered solver
+ * @var SolverOptions::time_budget_ms Time budget of the anytime solvers (local search, simulated annealing)
+ * @var SolverOptions::threads Number of threads for the parallel solvers (0 uses the hardware concurrency)
+ */
+struct SolverOptions
+{
+    double time_budget_ms = 1000.0;
+    unsigned int threads = 0;
+};
+
+/**
+ * @brief Outcome of one registered solver on one instance
+ * @var SolverResult::solver Registry name of the solver
+ * @var SolverResult::ran Whether the solver ran; false when it does not apply to the instance
+ * @var SolverResult::message Why the solver did not run, or a note about the result
+ * @var SolverResult::total_profit Total profit of selected pallets
+ * @var SolverResult::total_weight Total weight of selected pallets
+ * @var SolverResult::total_volume Total volume of selected pallets (0 without volumes)
+ * @var SolverResult::pallet_count Number of pallets selected
+ * @var SolverResult::used_pallets Boolean vector indicating which pallets are used
+ * @var SolverResult::optimal Whether the loading is proven optimal
+ * @var SolverResult::elapsed_ms Time spent in the solver in milliseconds (wall clock)
+ * @var SolverResult::user_ms User-mode CPU time of the thread that ran the solver
+ * @var SolverResult::sys_ms Kernel CPU time of the thread that ran the solver
+ * @var SolverResult::cached Whether the result came from a SolutionCache instead of the solver
+ */
+struct SolverResult
+{
+    std::string solver;
+    bool ran = false;
+    std::string message;
+    unsigned int total_profit = 0;
+    unsigned int total_weight = 0;
+    unsigned int total_volume = 0;
+    unsigned int pallet_count = 0;
+    std::vector<bool> used_pallets;
+    bool optimal = false;
+    double elapsed_ms = 0.0;
+    double user_ms = 0.0;
+    double sys_ms = 0.0;
+    bool cached = false;
+};
+
+/**
+ * @brief One entry of the solver registry
+ * @var SolverInfo::name Short name used on the command line (e.g. "dp")
+ * @var SolverInfo::description Human-readable name
+ * @var SolverInfo::exact Whether the solver proves optimality when it finishes
+ * @var SolverInfo::enforces_pallet_limit Whether the solver respects InstanceView::max_pallets
+ * @var SolverInfo::uses_volumes Whether the solver respects the volume constraint
+ * @var SolverInfo::run Runs the solver; fills in everything but solver and the times
+ */
+struct SolverInfo
+{
+    const char *name;
+    const char *description;
+    bool exact;
+    bool enforces_pallet_limit;
+    bool uses_volumes;
+    void (*run)(const InstanceView &instance, const SolverOptions &options, SolverResult &result);
+};
+
+/**
+ * @brief Every registered solver, in the order of the algorithms menu
+ * @return The registry
+ */
+const std::vector<SolverInfo> &solverRegistry();
+
+/**
+ * @brief Looks a solver up by its short name
+ * @param name Short name, as in SolverInfo::name
+ * @return The entry, or nullptr if no solver has that name
+ */
+const SolverInfo *findSolver(const std::string &name);
+
+/**
+ * @brief Runs one registered solver and times it
+ * @param solver Registry entry to run
+ * @param instance Instance to solve
+ * @param options Solver settings
+ * @return SolverResult with the loading, or ran = false and the reason in message
+ * @note Solvers that ignore the pallet limit or the volumes still run; the result says so in
+ *       message and is never marked optimal.
+ */
+SolverResult runSolver(const SolverInfo &solver, const InstanceView &instance, const SolverOptions &options);
+
+#endif // SOLVERREGISTRY_H
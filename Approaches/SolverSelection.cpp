@@ -0,0 +1,253 @@
+#include "SolverSelection.h"
+#include "SolverRegistry.h"
+#include "CoreKnapsack.h"
+#include "DynamicProgramming.h"
+#include "MeetInTheMiddle.h"
+#include "TwoDimensional.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+static const double NEVER = std::numeric_limits<double>::infinity();
+
+// the coefficients by the names used in cost model files
+static const std::pair<const char *, double CostModel::*> COST_MODEL_FIELDS[] = {
+    {"bf_ns_per_subset", &CostModel::bf_ns_per_subset},
+    {"mitm_ns_per_subset", &CostModel::mitm_ns_per_subset},
+    {"dp_ns_per_cell", &CostModel::dp_ns_per_cell},
+    {"dp2d_ns_per_cell", &CostModel::dp2d_ns_per_cell},
+    {"bb_ns_per_node", &CostModel::bb_ns_per_node},
+    {"bb_correlation_exponent", &CostModel::bb_correlation_exponent},
+    {"core_ns_per_item", &CostModel::core_ns_per_item},
+};
+
+// how far below a perfect correlation instances stop being hard for the LP bounds
+static const double CORRELATION_KNEE = 0.01;
+
+static CostModel g_active_model;
+
+InstanceFeatures computeFeatures(const InstanceView &instance)
+{
+    InstanceFeatures features;
+    features.n = instance.n;
+    features.capacity = instance.capacity;
+
+    double sumW = 0, sumP = 0, sumWW = 0, sumPP = 0, sumWP = 0;
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < instance.n; i++)
+    {
+        unsigned int w = instance.weights[i], p = instance.profits[i];
+        if (w > instance.capacity)
+            continue;
+        features.weight_sum += w;
+        features.profit_sum += p;
+        sumW += w;
+        sumP += p;
+        sumWW += static_cast<double>(w) * w;
+        sumPP += static_cast<double>(p) * p;
+        sumWP += static_cast<double>(w) * p;
+        count++;
+    }
+
+    features.correlation = 1.0;
+    if (count > 1)
+    {
+        double varW = sumWW - sumW * sumW / count;
+        double varP = sumPP - sumP * sumP / count;
+        if (varW > 0 && varP > 0)
+            features.correlation = (sumWP - sumW * sumP / count) / std::sqrt(varW * varP);
+    }
+    return features;
+}
+
+// 0 for unrelated weights and profits, 1 when profits follow the weights exactly (ratios leave no slack)
+static double hardness(double correlation)
+{
+    return std::exp(-(1.0 - std::max(correlation, 0.0)) / CORRELATION_KNEE);
+}
+
+// predicted branch-and-bound nodes: polynomial in n, steeper on hard instances
+static double branchAndBoundNodes(double n, double correlation, const CostModel &model)
+{
+    double nodes = std::pow(std::max(n, 2.0), 1.0 + model.bb_correlation_exponent * hardness(correlation));
+    return std::min(nodes, std::pow(2.0, std::min(n, 1000.0)));
+}
+
+// predicted milliseconds of one solver, or NEVER when it does not apply
+static double estimateMs(const std::string &solver, const InstanceView &instance, const InstanceFeatures &features,
+                         const CostModel &model)
+{
+    double n = features.n;
+    double cells = (n + 1) * (features.capacity + 1.0);
+    double ns = NEVER;
+    if (solver == "bf" && features.n <= REGISTRY_EXHAUSTIVE_MAX_PALLETS)
+    {
+        ns = model.bf_ns_per_subset * std::pow(2.0, n);
+    }
+    else if (solver == "mitm" && features.n <= MITM_MAX_PALLETS)
+    {
+        ns = model.mitm_ns_per_subset * 2 * std::pow(2.0, std::ceil(n / 2));
+    }
+    else if (solver == "dp")
+    {
+        if (instance.max_pallets == 0 && cells <= REGISTRY_DP_CELL_LIMIT)
+            ns = model.dp_ns_per_cell * cells;
+        else if (instance.max_pallets != 0 &&
+                 knapsackDPCardinalityFits(instance.weights, instance.n, instance.capacity, instance.max_pallets))
+            ns = model.dp_ns_per_cell * cells * (std::min(instance.max_pallets, instance.n) + 1.0);
+    }
+    else if (solver == "bb" || solver == "bb2d")
+    {
+        ns = model.bb_ns_per_node * branchAndBoundNodes(n, features.correlation, model);
+    }
+    else if (solver == "core")
+    {
+        // the reduction is cheap next to any exact solve, so the real core size is measured
+        CoreReduction reduction = reduceToCore(instance.profits, instance.weights, instance.n, instance.capacity);
+        double core = reduction.core.size();
+        double coreCells = (core + 1) * (reduction.capacity + 1.0);
+        ns = model.core_ns_per_item * n * std::log2(n + 2);
+        if (core > 0)
+            ns += coreCells <= CORE_DP_CELL_LIMIT
+                      ? model.dp_ns_per_cell * coreCells
+                      : model.bb_ns_per_node * branchAndBoundNodes(core, features.correlation, model);
+    }
+    else if (solver == "dp2d" &&
+             twoDimDPFits(instance.weights, instance.volumes, instance.n, instance.capacity, instance.volume_capacity))
+    {
+        ns = model.dp2d_ns_per_cell * n * (features.capacity + 1.0) * (instance.volume_capacity + 1.0);
+    }
+    return ns / 1e6;
+}
+
+static std::string formatEstimate(double ms)
+{
+    std::ostringstream text;
+    if (ms < 1)
+        text << "<1 ms";
+    else if (ms < 1e7)
+        text << static_cast<long long>(std::llround(ms)) << " ms";
+    else
+        text << "~" << std::setprecision(1) << std::scientific << ms << " ms";
+    return text.str();
+}
+
+SolverChoice chooseSolver(const InstanceView &instance, double budgetMs, const CostModel &model)
+{
+    InstanceFeatures features = computeFeatures(instance);
+    std::vector<std::string> candidates;
+    if (instance.volumes != nullptr)
+        candidates = {"dp2d", "bb2d"};
+    else if (instance.max_pallets != 0)
+        candidates = {"bf", "dp", "bb"};
+    else
+        candidates = {"bf", "mitm", "dp", "core", "bb"};
+
+    SolverChoice choice;
+    double best = NEVER;
+    for (const std::string &name : candidates)
+    {
+        double ms = estimateMs(name, instance, features, model);
+        if (ms == NEVER)
+            continue;
+        choice.estimates.emplace_back(name, ms);
+        if (ms < best)
+        {
+            best = ms;
+            choice.solver = name;
+        }
+    }
+
+    std::ostringstream reason;
+    reason << "n=" << features.n << " W=" << features.capacity << " profit sum=" << features.profit_sum
+           << " correlation=" << std::fixed << std::setprecision(2) << features.correlation << "; ";
+    bool fallback = instance.volumes == nullptr && (choice.solver.empty() || best > budgetMs);
+    if (fallback)
+    {
+        reason << (choice.solver.empty() ? "no exact solver applies"
+                                         : "fastest exact solver (" + choice.solver + ", " + formatEstimate(best) +
+                                               ") is over the " + formatEstimate(budgetMs) + " budget")
+               << ", running local search for the budget";
+        choice.solver = "local-search";
+        choice.estimated_ms = budgetMs;
+    }
+    else
+    {
+        reason << "predicted " << formatEstimate(best);
+        for (const auto &[name, ms] : choice.estimates)
+        {
+            if (name != choice.solver)
+                reason << ", " << name << " " << formatEstimate(ms);
+        }
+        choice.estimated_ms = best;
+    }
+    choice.reason = reason.str();
+    return choice;
+}
+
+const CostModel &activeCostModel()
+{
+    return g_active_model;
+}
+
+void setActiveCostModel(const CostModel &model)
+{
+    g_active_model = model;
+}
+
+bool loadCostModel(const std::string &path, CostModel &model, std::string &error)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    std::string line;
+    unsigned int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        std::istringstream fields(line);
+        std::string name;
+        double value;
+        if (!(fields >> name) || name[0] == '#')
+            continue;
+        if (!(fields >> value) || !std::isfinite(value) || value < 0)
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": expected a non-negative number after " + name;
+            return false;
+        }
+
+        bool known = false;
+        for (const auto &[field, member] : COST_MODEL_FIELDS)
+        {
+            if (name == field)
+            {
+                model.*member = value;
+                known = true;
+            }
+        }
+        if (!known)
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": unknown coefficient " + name;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool saveCostModel(const std::string &path, const CostModel &model)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+        return false;
+    file << "# cost model coefficients (nanoseconds per unit of work)\n";
+    for (const auto &[field, member] : COST_MODEL_FIELDS)
+        file << field << " " << model.*member << "\n";
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file SolverSelection.h
+ * @brief Cost model that predicts solver run times from instance features and picks a solver
+ */
+
+#ifndef SOLVERSELECTION_H
+#define SOLVERSELECTION_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Coefficients of the cost model, in nanoseconds per unit of work
+ * @var CostModel::bf_ns_per_subset Exhaustive search, per subset (2^n subsets)
+ * @var CostModel::mitm_ns_per_subset Meet-in-the-middle, per subset of a half (2^(n/2) per half)
+ * @var CostModel::dp_ns_per_cell Dynamic programming, per table cell ((n + 1) × (W + 1))
+ * @var CostModel::dp2d_ns_per_cell Weight + volume dynamic programming, per pallet and layer cell
+ * @var CostModel::bb_ns_per_node Branch-and-bound, per node
+ * @var CostModel::bb_correlation_exponent Growth of the branch-and-bound node count on hard
+ *      instances: n^(1 + exponent × h) nodes, where h = exp(-(1 - ρ) / 0.01) goes from 0 for
+ *      unrelated weights and profits to 1 when the correlation ρ is perfect
+ * @var CostModel::core_ns_per_item Core approach, per pallet and sort level (n log n); the core
+ *      itself is measured with reduceToCore and priced as a DP table or branch-and-bound nodes
+ */
+struct CostModel
+{
+    double bf_ns_per_subset = 120.0;
+    double mitm_ns_per_subset = 85.0;
+    double dp_ns_per_cell = 18.0;
+    double dp2d_ns_per_cell = 2.0;
+    double bb_ns_per_node = 150.0;
+    double bb_correlation_exponent = 2.0;
+    double core_ns_per_item = 25.0;
+};
+
+/**
+ * @brief What the cost model looks at
+ * @var InstanceFeatures::n Number of pallets
+ * @var InstanceFeatures::capacity Truck capacity W
+ * @var InstanceFeatures::weight_sum Total weight of the pallets that fit on their own
+ * @var InstanceFeatures::profit_sum Total profit of those pallets
+ * @var InstanceFeatures::correlation Pearson correlation of their weights and profits (1 when
+ *      either is constant: every pallet then has the same ratio, the hard case for bounds)
+ */
+struct InstanceFeatures
+{
+    unsigned int n = 0;
+    unsigned int capacity = 0;
+    unsigned long long weight_sum = 0;
+    unsigned long long profit_sum = 0;
+    double correlation = 0.0;
+};
+
+/**
+ * @brief A solver picked by the cost model, and why
+ * @var SolverChoice::solver Registry name of the chosen solver
+ * @var SolverChoice::estimated_ms Predicted run time of the chosen solver
+ * @var SolverChoice::reason One-line explanation, for the log
+ * @var SolverChoice::estimates Predicted run time of every exact candidate that applies
+ */
+struct SolverChoice
+{
+    std::string solver;
+    double estimated_ms = 0.0;
+    std::string reason;
+    std::vector<std::pair<std::string, double>> estimates;
+};
+
+/**
+ * @brief Measures the features the cost model uses
+ * @param instance Instance to describe
+ * @return Its features
+ * @note Time Complexity: O(n)
+ */
+InstanceFeatures computeFeatures(const InstanceView &instance);
+
+/**
+ * @brief Picks the solver predicted to finish first
+ * @param instance Instance to solve
+ * @param budgetMs Largest predicted time accepted for an exact solver
+ * @param model Cost model coefficients
+ * @return The choice, with the estimates it was based on
+ * @note Candidates are the exact solvers that apply to the instance: exhaustive search,
+ *       meet-in-the-middle, dynamic programming, branch-and-bound and the core approach, or the
+ *       two weight + volume solvers when there is a volume column. Solvers that ignore a pallet
+ *       limit are left out when there is one.
+ * @note When every exact candidate is predicted to take longer than budgetMs, local search (run
+ *       for the budget) is chosen instead; with volumes there is no heuristic to fall back to
+ *       and the fastest exact candidate is kept.
+ */
+SolverChoice chooseSolver(const InstanceView &instance, double budgetMs, const CostModel &model);
+
+/**
+ * @brief Cost model used by the "auto" solver
+ * @return The coefficients set by setActiveCostModel, or the built-in ones
+ */
+const CostModel &activeCostModel();
+
+/**
+ * @brief Replaces the cost model used by the "auto" solver
+ * @param model New coefficients
+ * @note Meant to be called once at startup, before any solver runs.
+ */
+void setActiveCostModel(const CostModel &model);
+
+/**
+ * @brief Reads cost model coefficients from a file of "name value" lines
+ * @param path File to read; lines starting with # are comments
+ * @param model Receives the coefficients; names missing from the file keep their value
+ * @param error Receives the reason on failure
+ * @return true on success
+ */
+bool loadCostModel(const std::string &path, CostModel &model, std::string &error);
+
+/**
+ * @brief Writes cost model coefficients in the format loadCostModel reads
+ * @param path File to write
+ * @param model Coefficients to write
+ * @return true on success
+ */
+bool saveCostModel(const std::string &path, const CostModel &model);
+
+#endif // SOLVERSELECTION_H
@@ -0,0 +1,359 @@
+#include "TwoDimensional.h"
+#include "../Output/ProgressBar.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+// branch-and-bound nodes between two cancellation checks
+static const unsigned long long CANCEL_CHECK_INTERVAL = 100000;
+
+// slack added before rounding a floating-point bound down, so rounding errors never cut it below the optimum
+static const double BOUND_EPSILON = 1e-6;
+
+/**
+ * Pallets that fit on their own, with weights and volumes divided by their GCD and the
+ * capacities cut down to what those pallets could ever use.
+ */
+struct TwoDimScaling
+{
+    std::vector<unsigned int> fitting;
+    unsigned int weightUnit;
+    unsigned int volumeUnit;
+    unsigned long long maxWeight;
+    unsigned long long maxVolume;
+
+    unsigned long long cells() const { return (maxWeight + 1) * (maxVolume + 1); }
+};
+
+static TwoDimScaling scaleInstance(const unsigned int weights[], const unsigned int volumes[], unsigned int n,
+                                   unsigned int max_weight, unsigned int max_volume)
+{
+    TwoDimScaling scaling;
+    unsigned int weightGcd = 0, volumeGcd = 0;
+    unsigned long long totalWeight = 0, totalVolume = 0;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (weights[i] <= max_weight && volumes[i] <= max_volume)
+        {
+            scaling.fitting.push_back(i);
+            weightGcd = std::gcd(weightGcd, weights[i]);
+            volumeGcd = std::gcd(volumeGcd, volumes[i]);
+            totalWeight += weights[i];
+            totalVolume += volumes[i];
+        }
+    }
+
+    // a GCD of 0 means every fitting pallet has zero weight (or volume): one cell is enough
+    scaling.weightUnit = std::max(1u, weightGcd);
+    scaling.volumeUnit = std::max(1u, volumeGcd);
+    scaling.maxWeight = std::min<unsigned long long>(max_weight, totalWeight) / scaling.weightUnit;
+    scaling.maxVolume = std::min<unsigned long long>(max_volume, totalVolume) / scaling.volumeUnit;
+    return scaling;
+}
+
+/**
+ * Fitting pallets in decreasing profit per surrogate weight λ·w/W + (1-λ)·v/V, with prefix sums,
+ * so the Dantzig bound of "pallets from position k on, with this much surrogate capacity left"
+ * is answered in O(log n).
+ */
+class SurrogateOrder
+{
+public:
+    std::vector<unsigned int> order;
+    std::vector<double> prefixSize;
+    std::vector<unsigned long long> prefixProfit;
+
+    SurrogateOrder(const unsigned int profits[], const unsigned int weights[], const unsigned int volumes[],
+                   const std::vector<unsigned int> &fitting, unsigned int max_weight, unsigned int max_volume,
+                   double multiplier)
+        : order(fitting), prefixSize(fitting.size() + 1, 0.0), prefixProfit(fitting.size() + 1, 0),
+          profits(profits), weights(weights), volumes(volumes),
+          weightScale(max_weight > 0 ? multiplier / max_weight : 0.0),
+          volumeScale(max_volume > 0 ? (1.0 - multiplier) / max_volume : 0.0)
+    {
+        // on ties keep the lower index first
+        std::stable_sort(order.begin(), order.end(),
+                         [this](unsigned int a, unsigned int b) { return ratio(a) > ratio(b); });
+        for (unsigned int k = 0; k < order.size(); k++)
+        {
+            prefixSize[k + 1] = prefixSize[k] + size(order[k]);
+            prefixProfit[k + 1] = prefixProfit[k] + profits[order[k]];
+        }
+    }
+
+    // surrogate weight of one pallet
+    double size(unsigned int pallet) const
+    {
+        return weightScale * weights[pallet] + volumeScale * volumes[pallet];
+    }
+
+    // profit per surrogate weight; pallets taking no room come first
+    double ratio(unsigned int pallet) const
+    {
+        double palletSize = size(pallet);
+        return palletSize > 0 ? profits[pallet] / palletSize : std::numeric_limits<double>::infinity();
+    }
+
+    // surrogate capacity left with the given residual weight and volume
+    double capacity(unsigned long long weightLeft, unsigned long long volumeLeft) const
+    {
+        return weightScale * weightLeft + volumeScale * volumeLeft;
+    }
+
+    // Dantzig bound on the profit obtainable from positions [position, n) with the given surrogate capacity
+    unsigned long long bound(unsigned int position, double residual) const
+    {
+        double limit = prefixSize[position] + residual + BOUND_EPSILON;
+        // last position k such that all pallets in [position, k) fit
+        unsigned int k = std::upper_bound(prefixSize.begin() + position, prefixSize.end(), limit) -
+                         prefixSize.begin() - 1;
+        double value = prefixProfit[k] - prefixProfit[position];
+        if (k < order.size())
+            value += (limit - prefixSize[k]) * profits[order[k]] / size(order[k]);
+        return static_cast<unsigned long long>(std::floor(value + BOUND_EPSILON));
+    }
+
+private:
+    const unsigned int *profits;
+    const unsigned int *weights;
+    const unsigned int *volumes;
+    double weightScale;
+    double volumeScale;
+};
+
+unsigned long long twoDimSurrogateBound(const unsigned int profits[], const unsigned int weights[],
+                                        const unsigned int volumes[], unsigned int n,
+                                        unsigned int max_weight, unsigned int max_volume, double &multiplier)
+{
+    std::vector<unsigned int> fitting;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (weights[i] <= max_weight && volumes[i] <= max_volume)
+            fitting.push_back(i);
+    }
+
+    unsigned long long best = 0;
+    multiplier = 0.5;
+    for (unsigned int step = 0; step <= TWO_DIM_MULTIPLIER_STEPS; step++)
+    {
+        double lambda = static_cast<double>(step) / TWO_DIM_MULTIPLIER_STEPS;
+        SurrogateOrder sorted(profits, weights, volumes, fitting, max_weight, max_volume, lambda);
+        unsigned long long bound = sorted.bound(0, sorted.capacity(max_weight, max_volume));
+        if (step == 0 || bound < best)
+        {
+            best = bound;
+            multiplier = lambda;
+        }
+    }
+    return best;
+}
+
+bool twoDimDPFits(const unsigned int weights[], const unsigned int volumes[], unsigned int n,
+                  unsigned int max_weight, unsigned int max_volume)
+{
+    TwoDimScaling scaling = scaleInstance(weights, volumes, n, max_weight, max_volume);
+    unsigned long long cells = scaling.cells();
+    return cells <= TWO_DIM_DP_CELL_LIMIT && scaling.fitting.size() * cells <= TWO_DIM_DP_BIT_LIMIT;
+}
+
+TwoDimSol knapsack2DDP(const unsigned int profits[], const unsigned int weights[],
+                       const unsigned int volumes[], unsigned int n,
+                       unsigned int max_weight, unsigned int max_volume)
+{
+    TwoDimSol solution = {0, 0, 0, 0, std::vector<bool>(n, false), 0, 0, "2D Dynamic Programming"};
+    double multiplier;
+    solution.upper_bound = twoDimSurrogateBound(profits, weights, volumes, n, max_weight, max_volume, multiplier);
+
+    TwoDimScaling scaling = scaleInstance(weights, volumes, n, max_weight, max_volume);
+    const std::vector<unsigned int> &fitting = scaling.fitting;
+    unsigned long long rowCells = scaling.maxVolume + 1;
+    size_t cells = scaling.cells();
+    size_t rowWords = (cells + 63) / 64;
+
+    // best[w * rowCells + v]: best loading with at most w weight units and v volume units
+    std::vector<unsigned int> best(cells, 0);
+    std::vector<unsigned int> count(cells, 0);
+    std::vector<unsigned long long> indexSum(cells, 0);
+    std::vector<uint64_t> takeBits(fitting.size() * rowWords, 0);
+
+    for (unsigned int k = 0; k < fitting.size(); k++)
+    {
+        unsigned int pallet = fitting[k];
+        unsigned long long weight = weights[pallet] / scaling.weightUnit;
+        unsigned long long volume = volumes[pallet] / scaling.volumeUnit;
+        uint64_t *row = takeBits.data() + k * rowWords;
+        size_t shift = weight * rowCells + volume;
+
+        // both capacities descending: the cell read still holds the layer before this pallet
+        for (unsigned long long w = scaling.maxWeight + 1; w-- > weight;)
+        {
+            for (unsigned long long v = scaling.maxVolume + 1; v-- > volume;)
+            {
+                size_t cell = w * rowCells + v;
+                size_t from = cell - shift;
+                unsigned int valueWithItem = best[from] + profits[pallet];
+                unsigned int countWithItem = count[from] + 1;
+                unsigned long long indexSumWithItem = indexSum[from] + pallet;
+
+                bool take = valueWithItem > best[cell] ||
+                            (valueWithItem == best[cell] &&
+                             (countWithItem < count[cell] ||
+                              (countWithItem == count[cell] && indexSumWithItem < indexSum[cell])));
+                if (take)
+                {
+                    best[cell] = valueWithItem;
+                    count[cell] = countWithItem;
+                    indexSum[cell] = indexSumWithItem;
+                    row[cell / 64] |= uint64_t(1) << (cell % 64);
+                }
+            }
+        }
+    }
+
+    // walk the pallets backwards, following the take bit at the remaining capacities
+    size_t cell = cells - 1;
+    for (size_t k = fitting.size(); k-- > 0;)
+    {
+        if (takeBits[k * rowWords + cell / 64] >> (cell % 64) & 1)
+        {
+            unsigned int pallet = fitting[k];
+            solution.used_pallets[pallet] = true;
+            solution.total_profit += profits[pallet];
+            solution.total_weight += weights[pallet];
+            solution.total_volume += volumes[pallet];
+            solution.pallet_count++;
+            cell -= weights[pallet] / scaling.weightUnit * rowCells + volumes[pallet] / scaling.volumeUnit;
+        }
+    }
+
+    return solution;
+}
+
+TwoDimSol knapsack2DBranchAndBound(const unsigned int profits[], const unsigned int weights[],
+                                   const unsigned int volumes[], unsigned int n,
+                                   unsigned int max_weight, unsigned int max_volume,
+                                   std::stop_source stop)
+{
+    TwoDimSol solution = {0, 0, 0, 0, std::vector<bool>(n, false), 0, 0, "2D Branch-and-Bound"};
+    double multiplier;
+    solution.upper_bound = twoDimSurrogateBound(profits, weights, volumes, n, max_weight, max_volume, multiplier);
+
+    TwoDimScaling scaling = scaleInstance(weights, volumes, n, max_weight, max_volume);
+    SurrogateOrder sorted(profits, weights, volumes, scaling.fitting, max_weight, max_volume, multiplier);
+    unsigned int m = sorted.order.size();
+
+    // the loading on the way down, by surrogate-order position, and the positions taken, deepest last
+    std::vector<bool> taken(m, false);
+    std::vector<bool> bestTaken(m, false);
+    std::vector<unsigned int> takenStack;
+    unsigned long long bestProfit = 0;
+    unsigned int bestCount = 0;
+    unsigned long long bestIndexSum = 0;
+    bool haveIncumbent = false;
+
+    unsigned long long weight = 0;
+    unsigned long long volume = 0;
+    unsigned long long profit = 0;
+    unsigned long long indexSum = 0;
+    unsigned int position = 0;
+    unsigned long long nodes = 0;
+
+    ProgressBar progress(1, true);
+    bool user_cancelled = false;
+    bool stopped = false;
+
+    while (true)
+    {
+        nodes++;
+        if (nodes % CANCEL_CHECK_INTERVAL == 0)
+        {
+            if (!progress.update(nodes))
+            {
+                user_cancelled = true;
+                stop.request_stop();
+            }
+            stopped = user_cancelled || stop.stop_requested();
+            if (stopped)
+                break;
+        }
+
+        // strict: an equal bound may still hide a loading with fewer pallets
+        bool prune = haveIncumbent &&
+                     profit + sorted.bound(position, sorted.capacity(max_weight - weight, max_volume - volume)) <
+                         bestProfit;
+
+        if (!prune && position < m)
+        {
+            unsigned int pallet = sorted.order[position];
+            if (weight + weights[pallet] <= max_weight && volume + volumes[pallet] <= max_volume)
+            {
+                // the pallet fits both residual capacities: load it before trying without it
+                taken[position] = true;
+                takenStack.push_back(position);
+                weight += weights[pallet];
+                volume += volumes[pallet];
+                profit += profits[pallet];
+                indexSum += pallet;
+            }
+            position++;
+            continue;
+        }
+
+        if (!prune)
+        {
+            // leaf: keep it if it wins the knapsackDP tie-break
+            unsigned int count = takenStack.size();
+            bool better = !haveIncumbent || profit > bestProfit ||
+                          (profit == bestProfit &&
+                           (count < bestCount || (count == bestCount && indexSum < bestIndexSum)));
+            if (better)
+            {
+                bestProfit = profit;
+                bestCount = count;
+                bestIndexSum = indexSum;
+                bestTaken = taken;
+                haveIncumbent = true;
+            }
+        }
+
+        // unload the most recently loaded pallet and continue just after it without it
+        if (takenStack.empty())
+            break;
+        unsigned int last = takenStack.back();
+        takenStack.pop_back();
+        unsigned int pallet = sorted.order[last];
+        taken[last] = false;
+        weight -= weights[pallet];
+        volume -= volumes[pallet];
+        profit -= profits[pallet];
+        indexSum -= pallet;
+        position = last + 1;
+    }
+
+    solution.nodes_explored = nodes;
+
+    if (stopped)
+    {
+        if (user_cancelled)
+            std::cout << "\nOperation cancelled by user. Returning to menu." << std::endl;
+        return solution;
+    }
+
+    for (unsigned int k = 0; k < m; k++)
+    {
+        if (bestTaken[k])
+        {
+            unsigned int pallet = sorted.order[k];
+            solution.used_pallets[pallet] = true;
+            solution.total_profit += profits[pallet];
+            solution.total_weight += weights[pallet];
+            solution.total_volume += volumes[pallet];
+            solution.pallet_count++;
+        }
+    }
+
+    return solution;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file TwoDimensional.h
+ * @brief Header for the two-constraint (weight + volume) pallet loading solvers
+ */
+
+#ifndef TWODIMENSIONAL_H
+#define TWODIMENSIONAL_H
+
+#include <stop_token>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Largest number of (weight, volume) cells in one 2D DP layer, after scaling
+ */
+const unsigned long long TWO_DIM_DP_CELL_LIMIT = 1ull << 26;
+
+/**
+ * @brief Largest pallets × cells product for the 2D DP (one take bit per pallet and cell)
+ */
+const unsigned long long TWO_DIM_DP_BIT_LIMIT = 1ull << 32;
+
+/**
+ * @brief Number of surrogate multipliers tried when looking for the tightest root bound
+ */
+const unsigned int TWO_DIM_MULTIPLIER_STEPS = 16;
+
+/**
+ * @brief Structure to hold a weight + volume loading
+ * @var TwoDimSol::total_profit Total profit of selected pallets
+ * @var TwoDimSol::total_weight Total weight of selected pallets
+ * @var TwoDimSol::total_volume Total volume of selected pallets
+ * @var TwoDimSol::pallet_count Number of pallets selected
+ * @var TwoDimSol::used_pallets Boolean vector indicating which pallets are used
+ * @var TwoDimSol::upper_bound Surrogate relaxation bound on the profit
+ * @var TwoDimSol::nodes_explored Number of branch-and-bound nodes explored, 0 for the DP
+ * @var TwoDimSol::solver_name Name of the solver that produced the solution
+ */
+struct TwoDimSol
+{
+    unsigned int total_profit;
+    unsigned int total_weight;
+    unsigned int total_volume;
+    unsigned int pallet_count;
+    std::vector<bool> used_pallets;
+    unsigned long long upper_bound;
+    unsigned long long nodes_explored;
+    std::string solver_name;
+};
+
+/**
+ * @brief Surrogate relaxation bound for the weight + volume knapsack
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param volumes Array of volume values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_volume Maximum volume capacity of truck
+ * @param multiplier Receives the weight multiplier λ of the tightest bound found
+ * @return Upper bound on the profit of any feasible loading
+ * @note Both constraints are normalized and merged as λ·w/W + (1-λ)·v/V ≤ 1; the Dantzig bound
+ *       of that single knapsack is computed for TWO_DIM_MULTIPLIER_STEPS + 1 values of λ in
+ *       [0, 1] and the smallest is kept. λ = 0 and λ = 1 are the volume-only and weight-only bounds.
+ * @note Time Complexity: O(S × n log n) for S multipliers
+ */
+unsigned long long twoDimSurrogateBound(const unsigned int profits[], const unsigned int weights[],
+                                        const unsigned int volumes[], unsigned int n,
+                                        unsigned int max_weight, unsigned int max_volume, double &multiplier);
+
+/**
+ * @brief Checks whether the 2D DP fits within TWO_DIM_DP_CELL_LIMIT and TWO_DIM_DP_BIT_LIMIT
+ * @param weights Array of weight values for each pallet
+ * @param volumes Array of volume values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_volume Maximum volume capacity of truck
+ * @return true if knapsack2DDP can be used on this instance
+ */
+bool twoDimDPFits(const unsigned int weights[], const unsigned int volumes[], unsigned int n,
+                  unsigned int max_weight, unsigned int max_volume);
+
+/**
+ * @brief Dynamic programming over (weight, volume) for the two-constraint knapsack
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param volumes Array of volume values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_volume Maximum volume capacity of truck
+ * @return TwoDimSol containing an optimal loading
+ * @note The table is compressed before solving: weights and volumes are divided by their GCD
+ *       over the pallets that fit, and each capacity is cut down to the total the pallets could
+ *       use. One rolling layer is kept, plus one take bit per pallet and cell for the reconstruction.
+ * @note Same tie-break as knapsackDP: on equal profit, fewer pallets, then lower indices.
+ * @note Time Complexity: O(n × W' × V') for the compressed capacities W' and V'
+ * @note Space Complexity: O(W' × V') for the layer + O(n × W' × V') bits
+ */
+TwoDimSol knapsack2DDP(const unsigned int profits[], const unsigned int weights[],
+                       const unsigned int volumes[], unsigned int n,
+                       unsigned int max_weight, unsigned int max_volume);
+
+/**
+ * @brief Branch-and-bound for the two-constraint knapsack, bounded by the surrogate relaxation
+ * @param profits Array of profit values for each pallet
+ * @param weights Array of weight values for each pallet
+ * @param volumes Array of volume values for each pallet
+ * @param n Number of pallets
+ * @param max_weight Maximum weight capacity of truck
+ * @param max_volume Maximum volume capacity of truck
+ * @param stop Stop source shared with other threads; the search gives up once a stop is requested
+ *             (checked every 100000 nodes), and Esc requests one
+ * @return TwoDimSol containing an optimal loading, or an empty loading when stopped
+ * @note Pallets are explored depth-first ("take" first) in decreasing profit per surrogate
+ *       weight, using the multiplier chosen by twoDimSurrogateBound. Each node is bounded by the
+ *       Dantzig bound of the surrogate constraint over the residual capacities, in O(log n).
+ * @note Same tie-break as knapsackDP; to keep it exact, only subtrees whose bound is strictly
+ *       below the incumbent profit are pruned.
+ * @note Time Complexity: O(n log n) for sorting + O(2^n) worst case for the search, usually far less
+ * @note Space Complexity: O(n)
+ */
+TwoDimSol knapsack2DBranchAndBound(const unsigned int profits[], const unsigned int weights[],
+                                   const unsigned int volumes[], unsigned int n,
+                                   unsigned int max_weight, unsigned int max_volume,
+                                   std::stop_source stop = std::stop_source(std::nostopstate));
+
+#endif // TWODIMENSIONAL_H
@@ -1,35 +1,81 @@
-# knapsack_solver.py
-
-
-from pulp import LpProblem, LpMaximize, LpVariable, lpSum
-import sys
-
-
-# Read input from file 
-
-with open(sys.argv[1], 'r') as f:
-    lines = f.readlines()
-    n = int(lines[0].strip())
-    capacity = int(lines[1].strip())
-    weights = list(map(int, lines[2].strip().split()))
-    profits = list(map(int, lines[3].strip().split()))
-
-# Setup LP problem
-model = LpProblem("Knapsack", LpMaximize)
-x = [LpVariable(f"x{i}", cat="Binary") for i in range(n)]
-
-model += lpSum(x[i] * profits[i] for i in range(n))
-model += lpSum(x[i] * weights[i] for i in range(n)) <= capacity
-
-# Solve
-model.solve()
-
-selected = [str(i) for i in range(n) if x[i].varValue > 0.5]
-total_profit = sum(profits[int(i)] for i in selected)
-total_weight = sum(weights[int(i)] for i in selected)
-
-# Write result to output file -- with a system call ---- open(sys.argv[2], 'r') as f 
-with open(sys.argv[2], 'w') as f:
-    f.write(f"{total_profit}\n")
-    f.write(f"{total_weight}\n")
-    f.write(" ".join(selected) + "\n")
+
+# knapsack_solver.py
+#
+# Usage:
+#   python3 knapsack_solver.py input.txt output.txt   solve one instance from a file into a file
+#   python3 knapsack_solver.py                        solve one instance from stdin to stdout
+#   python3 knapsack_solver.py --worker               solve instances from stdin until EOF (one process per session)
+#
+# Instance format (4 lines): n, capacity, weights, profits
+# Result format (3 lines):   total profit, total weight, selected 0-based indices
+
+
+import os
+import sys
+
+
+def protocol_stdout():
+    # keep the real stdout for results only; anything else written to fd 1 goes to stderr
+    result_fd = os.dup(1)
+    os.dup2(2, 1)
+    return os.fdopen(result_fd, "w")
+
+
+file_mode = len(sys.argv) == 3
+worker_mode = len(sys.argv) == 2 and sys.argv[1] == "--worker"
+
+# redirect before importing PuLP, so nothing it prints can end up in the results
+out = None if file_mode else protocol_stdout()
+
+from pulp import LpProblem, LpMaximize, LpVariable, lpSum, PULP_CBC_CMD
+
+
+def read_instance(stream):
+    header = stream.readline()
+    if not header.strip():
+        return None
+    n = int(header.strip())
+    capacity = int(stream.readline().strip())
+    weights = list(map(int, stream.readline().strip().split()))
+    profits = list(map(int, stream.readline().strip().split()))
+    return n, capacity, weights, profits
+
+
+def solve(n, capacity, weights, profits):
+    # Setup LP problem
+    model = LpProblem("Knapsack", LpMaximize)
+    x = [LpVariable(f"x{i}", cat="Binary") for i in range(n)]
+
+    model += lpSum(x[i] * profits[i] for i in range(n))
+    model += lpSum(x[i] * weights[i] for i in range(n)) <= capacity
+
+    # Solve (quietly, stdout may be carrying results)
+    model.solve(PULP_CBC_CMD(msg=False))
+
+    selected = [i for i in range(n) if x[i].varValue is not None and x[i].varValue > 0.5]
+    total_profit = sum(profits[i] for i in selected)
+    total_weight = sum(weights[i] for i in selected)
+    return total_profit, total_weight, selected
+
+
+def write_result(stream, result):
+    total_profit, total_weight, selected = result
+    stream.write(f"{total_profit}\n")
+    stream.write(f"{total_weight}\n")
+    stream.write(" ".join(str(i) for i in selected) + "\n")
+    stream.flush()
+
+
+if file_mode:
+    with open(sys.argv[1], 'r') as f:
+        instance = read_instance(f)
+    with open(sys.argv[2], 'w') as f:
+        write_result(f, solve(*instance))
+elif worker_mode:
+    while True:
+        instance = read_instance(sys.stdin)
+        if instance is None:
+            break
+        write_result(out, solve(*instance))
+else:
+    write_result(out, solve(*read_instance(sys.stdin)))
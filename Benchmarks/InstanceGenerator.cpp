@@ -0,0 +1,122 @@
+#include "InstanceGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+static const std::pair<InstanceFamily, const char *> FAMILY_NAMES[] = {
+    {InstanceFamily::Uncorrelated, "uncorrelated"},
+    {InstanceFamily::WeaklyCorrelated, "weak"},
+    {InstanceFamily::StronglyCorrelated, "strong"},
+    {InstanceFamily::InverseStronglyCorrelated, "inverse-strong"},
+    {InstanceFamily::AlmostStronglyCorrelated, "almost-strong"},
+    {InstanceFamily::SubsetSum, "subset-sum"},
+    {InstanceFamily::Spanner, "spanner"},
+};
+
+const std::vector<InstanceFamily> &allInstanceFamilies()
+{
+    static const std::vector<InstanceFamily> families = [] {
+        std::vector<InstanceFamily> list;
+        for (const auto &[family, name] : FAMILY_NAMES)
+            list.push_back(family);
+        return list;
+    }();
+    return families;
+}
+
+const char *familyName(InstanceFamily family)
+{
+    for (const auto &[entry, name] : FAMILY_NAMES)
+    {
+        if (entry == family)
+            return name;
+    }
+    return "unknown";
+}
+
+bool parseFamily(const std::string &name, InstanceFamily &family)
+{
+    for (const auto &[entry, entryName] : FAMILY_NAMES)
+    {
+        if (name == entryName)
+        {
+            family = entry;
+            return true;
+        }
+    }
+    return false;
+}
+
+Instance generateInstance(InstanceFamily family, const GeneratorSettings &settings)
+{
+    std::mt19937 rng(settings.seed);
+    long long range = std::clamp(settings.range, 1u, GENERATOR_MAX_RANGE);
+    auto uniform = [&rng](long long low, long long high)
+    {
+        return std::uniform_int_distribution<long long>(low, high)(rng);
+    };
+
+    // spanner pallets, scaled down so that their multiples stay around the range
+    std::vector<std::pair<long long, long long>> spanners;
+    if (family == InstanceFamily::Spanner)
+    {
+        long long scale = (SPANNER_MULTIPLIER + 1) / 2;
+        for (unsigned int k = 0; k < SPANNER_PALLETS; k++)
+        {
+            long long weight = uniform(1, range);
+            spanners.emplace_back(std::max(1LL, weight / scale), std::max(1LL, (weight + range / 10) / scale));
+        }
+    }
+
+    Instance instance;
+    instance.reserve(settings.n);
+    unsigned long long weightSum = 0;
+    for (unsigned int i = 0; i < settings.n; i++)
+    {
+        long long weight = 0, profit = 0;
+        switch (family)
+        {
+        case InstanceFamily::Uncorrelated:
+            weight = uniform(1, range);
+            profit = uniform(1, range);
+            break;
+        case InstanceFamily::WeaklyCorrelated:
+            weight = uniform(1, range);
+            profit = std::max(1LL, uniform(weight - range / 10, weight + range / 10));
+            break;
+        case InstanceFamily::StronglyCorrelated:
+            weight = uniform(1, range);
+            profit = weight + range / 10;
+            break;
+        case InstanceFamily::InverseStronglyCorrelated:
+            profit = uniform(1, range);
+            weight = profit + range / 10;
+            break;
+        case InstanceFamily::AlmostStronglyCorrelated:
+            weight = uniform(1, range);
+            profit = std::max(1LL, uniform(weight + range / 10 - range / 500, weight + range / 10 + range / 500));
+            break;
+        case InstanceFamily::SubsetSum:
+            weight = uniform(1, range);
+            profit = weight;
+            break;
+        case InstanceFamily::Spanner:
+        {
+            const auto &[spannerWeight, spannerProfit] = spanners[uniform(0, SPANNER_PALLETS - 1)];
+            long long multiplier = uniform(1, SPANNER_MULTIPLIER);
+            weight = multiplier * spannerWeight;
+            profit = multiplier * spannerProfit;
+            break;
+        }
+        }
+        instance.push_back(i + 1, static_cast<unsigned int>(weight), static_cast<unsigned int>(profit));
+        weightSum += weight;
+    }
+
+    double capacity = std::floor(settings.capacity_fraction * static_cast<double>(weightSum));
+    capacity = std::clamp(capacity, 1.0, static_cast<double>(std::numeric_limits<unsigned int>::max()));
+    instance.capacity = static_cast<unsigned int>(capacity);
+    return instance;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file InstanceGenerator.h
+ * @brief Generator of the standard synthetic 0/1 knapsack instance families (Pisinger)
+ */
+
+#ifndef INSTANCEGENERATOR_H
+#define INSTANCEGENERATOR_H
+
+#include <string>
+#include <vector>
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Instance families, as defined by Pisinger ("Where are the hard knapsack problems?", 2005)
+ */
+enum class InstanceFamily
+{
+    Uncorrelated,              ///< w and p uniform in [1, R]
+    WeaklyCorrelated,          ///< w uniform in [1, R], p uniform in [w - R/10, w + R/10] (at least 1)
+    StronglyCorrelated,        ///< w uniform in [1, R], p = w + R/10
+    InverseStronglyCorrelated, ///< p uniform in [1, R], w = p + R/10
+    AlmostStronglyCorrelated,  ///< w uniform in [1, R], p uniform in [w + R/10 - R/500, w + R/10 + R/500]
+    SubsetSum,                 ///< w uniform in [1, R], p = w
+    Spanner                    ///< multiples of a few strongly correlated spanner pallets
+};
+
+/**
+ * @brief Number of spanner pallets every pallet of a Spanner instance is a multiple of
+ */
+const unsigned int SPANNER_PALLETS = 2;
+
+/**
+ * @brief Largest multiplier of a spanner pallet
+ */
+const unsigned int SPANNER_MULTIPLIER = 10;
+
+/**
+ * @brief Bound on weights and profits as a multiple of the range R: no family goes past 2.2 R
+ *        (spanner multiples of strongly correlated pallets)
+ */
+const double GENERATOR_COEFFICIENT_FACTOR = 2.2;
+
+/**
+ * @brief Largest coefficient range R, so that GENERATOR_COEFFICIENT_FACTOR × R fits an unsigned int
+ */
+const unsigned int GENERATOR_MAX_RANGE = 1000000000;
+
+/**
+ * @brief Parameters of a generated instance
+ * @var GeneratorSettings::n Number of pallets
+ * @var GeneratorSettings::range Coefficient range R, from 1 to GENERATOR_MAX_RANGE
+ * @var GeneratorSettings::seed Seed of the random generator (same settings, same instance)
+ * @var GeneratorSettings::capacity_fraction Truck capacity as a fraction of the total weight
+ */
+struct GeneratorSettings
+{
+    unsigned int n = 50;
+    unsigned int range = 1000;
+    unsigned int seed = 1;
+    double capacity_fraction = 0.5;
+};
+
+/**
+ * @brief Every family, in the order of the enum
+ * @return The families
+ */
+const std::vector<InstanceFamily> &allInstanceFamilies();
+
+/**
+ * @brief Short name of a family, as used on the command line and in reports
+ * @param family The family
+ * @return "uncorrelated", "weak", "strong", "inverse-strong", "almost-strong", "subset-sum" or "spanner"
+ */
+const char *familyName(InstanceFamily family);
+
+/**
+ * @brief Looks a family up by its short name
+ * @param name Short name, as returned by familyName
+ * @param family Receives the family
+ * @return true if the name is known
+ */
+bool parseFamily(const std::string &name, InstanceFamily &family);
+
+/**
+ * @brief Generates one instance of a family
+ * @param family Family to draw from
+ * @param settings Size, range, seed and capacity fraction
+ * @return The instance, with pallets numbered from 1
+ * @note Spanner instances follow Pisinger's construction with v = SPANNER_PALLETS spanner pallets
+ *       (strongly correlated, scaled down by (SPANNER_MULTIPLIER + 1) / 2) and multipliers
+ *       drawn from [1, SPANNER_MULTIPLIER].
+ * @note A range outside [1, GENERATOR_MAX_RANGE] is clamped into it.
+ * @note The capacity is capacity_fraction × total weight, at least 1 and at most the largest
+ *       unsigned int.
+ * @note Time Complexity: O(n)
+ */
+Instance generateInstance(InstanceFamily family, const GeneratorSettings &settings);
+
+#endif // INSTANCEGENERATOR_H
@@ -0,0 +1,551 @@
+/**
+ * @file SolverBenchmark.cpp
+ * @brief Runs the registered solvers on generated instance families and reports robust timings
+ *
+ * Usage: ./solver_benchmark [options]
+ *
+ *   --families LIST       comma-separated families, or "all" (default: all)
+ *   --n LIST              comma-separated instance sizes (default: 50)
+ *   --range R             coefficient range (default: 1000); n × 2.2 R has to fit 32 bits
+ *   --seed S              generator seed (default: 1)
+ *   --capacity-fraction F capacity as a fraction of the total weight (default: 0.5)
+ *   --solvers LIST        comma-separated registry names, or "all" (default: all)
+ *   --repetitions K       measured runs per solver and instance (default: 5)
+ *   --warmup W            unmeasured runs before them (default: 1)
+ *   --time-limit MS       wall-clock limit per run, enforced in a child process (default: 2000)
+ *   --budget MS           time budget of the anytime solvers (default: 100)
+ *   --csv FILE            also write the results as CSV ("-" for stdout)
+ *   --json FILE           also write the results as JSON ("-" for stdout)
+ *   --calibrate FILE      fit the cost model to the measurements and save it (see --cost-model)
+ *
+ * Every solver runs on every generated instance in a forked child, warmup runs first, and the
+ * median, 95th percentile and minimum of the measured wall times are reported together with
+ * the median user and system CPU time. Exact solvers that disagree on the optimal profit are
+ * reported on stderr and make the exit code 1.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "InstanceGenerator.h"
+#include "../Approaches/SolverRegistry.h"
+#include "../Approaches/SolverSelection.h"
+#include "../Output/ProgressBar.h"
+#include "../Utils/IsolatedJob.h"
+#include "../Utils/Timing.h"
+
+static const unsigned int DEFAULT_REPETITIONS = 5;
+static const unsigned int DEFAULT_WARMUP = 1;
+static const double DEFAULT_TIME_LIMIT_MS = 2000.0;
+static const double DEFAULT_BUDGET_MS = 100.0;
+
+// runs faster than this are mostly timer and call overhead, too noisy to calibrate with
+static const double CALIBRATION_MIN_MS = 0.05;
+
+struct BenchmarkSettings
+{
+    std::vector<InstanceFamily> families = allInstanceFamilies();
+    std::vector<unsigned int> sizes = {50};
+    GeneratorSettings generator;
+    std::vector<std::string> solvers;
+    unsigned int repetitions = DEFAULT_REPETITIONS;
+    unsigned int warmup = DEFAULT_WARMUP;
+    double time_limit_ms = DEFAULT_TIME_LIMIT_MS;
+    double budget_ms = DEFAULT_BUDGET_MS;
+    std::string csv_path;
+    std::string json_path;
+    std::string calibrate_path;
+};
+
+// one solver on one generated instance
+struct BenchmarkRow
+{
+    std::string family;
+    unsigned int n = 0;
+    unsigned int capacity = 0;
+    std::string solver;
+    std::string status;
+    std::string message;
+    unsigned int profit = 0;
+    bool optimal = false;
+    std::vector<TimingSample> runs;
+    double predicted_ms = 0.0;
+    double median_ms = 0.0;
+    double p95_ms = 0.0;
+    double min_ms = 0.0;
+    double user_ms = 0.0;
+    double sys_ms = 0.0;
+};
+
+static std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+            items.push_back(item);
+    }
+    return items;
+}
+
+static void usage(const char *program)
+{
+    std::cerr << "Usage: " << program << " [--families LIST] [--n LIST] [--range R] [--seed S]"
+              << " [--capacity-fraction F] [--solvers LIST] [--repetitions K] [--warmup W]"
+              << " [--time-limit MS] [--budget MS] [--csv FILE] [--json FILE] [--calibrate FILE]\n"
+              << "Families: all";
+    for (InstanceFamily family : allInstanceFamilies())
+        std::cerr << ", " << familyName(family);
+    std::cerr << "\n";
+}
+
+static bool parseNumber(const std::string &text, double &value)
+{
+    char *end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && std::isfinite(value) && value >= 0;
+}
+
+static bool parseArguments(int argc, char *argv[], BenchmarkSettings &settings)
+{
+    for (const SolverInfo &solver : solverRegistry())
+        settings.solvers.push_back(solver.name);
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string flag = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value after " << flag << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+        double number = 0;
+        bool numeric = parseNumber(value, number);
+
+        if (flag == "--families")
+        {
+            settings.families.clear();
+            for (const std::string &name : splitList(value))
+            {
+                InstanceFamily family;
+                if (name == "all")
+                {
+                    settings.families = allInstanceFamilies();
+                }
+                else if (parseFamily(name, family))
+                {
+                    settings.families.push_back(family);
+                }
+                else
+                {
+                    std::cerr << "Unknown family " << name << "\n";
+                    return false;
+                }
+            }
+        }
+        else if (flag == "--n")
+        {
+            settings.sizes.clear();
+            for (const std::string &size : splitList(value))
+            {
+                double n = 0;
+                if (!parseNumber(size, n) || n < 1)
+                {
+                    std::cerr << "Bad size " << size << "\n";
+                    return false;
+                }
+                settings.sizes.push_back(static_cast<unsigned int>(n));
+            }
+        }
+        else if (flag == "--solvers")
+        {
+            settings.solvers = value == "all" ? settings.solvers : splitList(value);
+            for (const std::string &name : settings.solvers)
+            {
+                if (findSolver(name) == nullptr)
+                {
+                    std::cerr << "Unknown solver " << name << "\n";
+                    return false;
+                }
+            }
+        }
+        else if (flag == "--csv")
+        {
+            settings.csv_path = value;
+        }
+        else if (flag == "--json")
+        {
+            settings.json_path = value;
+        }
+        else if (flag == "--calibrate")
+        {
+            settings.calibrate_path = value;
+        }
+        else if (!numeric)
+        {
+            std::cerr << "Unknown option " << flag << " or bad value " << value << "\n";
+            return false;
+        }
+        else if (flag == "--range")
+        {
+            if (number < 1 || number > GENERATOR_MAX_RANGE)
+            {
+                std::cerr << "--range must be between 1 and " << GENERATOR_MAX_RANGE << "\n";
+                return false;
+            }
+            settings.generator.range = static_cast<unsigned int>(number);
+        }
+        else if (flag == "--seed")
+        {
+            settings.generator.seed = static_cast<unsigned int>(number);
+        }
+        else if (flag == "--capacity-fraction")
+        {
+            settings.generator.capacity_fraction = number;
+        }
+        else if (flag == "--repetitions")
+        {
+            settings.repetitions = std::max(1u, static_cast<unsigned int>(number));
+        }
+        else if (flag == "--warmup")
+        {
+            settings.warmup = static_cast<unsigned int>(number);
+        }
+        else if (flag == "--time-limit")
+        {
+            settings.time_limit_ms = number;
+        }
+        else if (flag == "--budget")
+        {
+            settings.budget_ms = number;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << flag << "\n";
+            return false;
+        }
+    }
+    if (settings.families.empty() || settings.sizes.empty() || settings.solvers.empty())
+        return false;
+
+    // the solvers add profits and weights in unsigned ints
+    unsigned int largest = *std::max_element(settings.sizes.begin(), settings.sizes.end());
+    if (largest * GENERATOR_COEFFICIENT_FACTOR * settings.generator.range > std::numeric_limits<unsigned int>::max())
+    {
+        std::cerr << "n=" << largest << " with --range " << settings.generator.range
+                  << " can overflow the 32-bit profit and weight totals; lower one of them\n";
+        return false;
+    }
+    return true;
+}
+
+// runs in the child: warmup runs, then the measured ones, one "wall user sys" line each
+static int measureSolver(const SolverInfo &solver, const InstanceView &instance, const BenchmarkSettings &settings,
+                         std::string &output)
+{
+    SolverOptions options;
+    options.time_budget_ms = settings.budget_ms;
+    std::ostringstream out;
+    out << std::setprecision(9);
+    for (unsigned int run = 0; run < settings.warmup + settings.repetitions; run++)
+    {
+        SolverResult result = runSolver(solver, instance, options);
+        if (!result.ran)
+        {
+            out << "skipped\n" << result.message << "\n";
+            break;
+        }
+        if (run == 0)
+            out << "ok " << result.total_profit << " " << result.optimal << "\n" << result.message << "\n";
+        if (run >= settings.warmup)
+            out << result.elapsed_ms << " " << result.user_ms << " " << result.sys_ms << "\n";
+    }
+    output = out.str();
+    return 0;
+}
+
+// value below which a fraction of the sorted samples lie (nearest rank)
+static double percentile(const std::vector<double> &sorted, double fraction)
+{
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+static void summarize(BenchmarkRow &row)
+{
+    if (row.runs.empty())
+        return;
+    std::vector<double> wall, user, sys;
+    for (const TimingSample &run : row.runs)
+    {
+        wall.push_back(run.wall_ms);
+        user.push_back(run.user_ms);
+        sys.push_back(run.sys_ms);
+    }
+    std::sort(wall.begin(), wall.end());
+    row.median_ms = median(wall);
+    row.p95_ms = percentile(wall, 0.95);
+    row.min_ms = wall.front();
+    row.user_ms = median(user);
+    row.sys_ms = median(sys);
+}
+
+static BenchmarkRow runCell(const std::string &family, const InstanceView &instance, const SolverInfo &solver,
+                            const BenchmarkSettings &settings)
+{
+    BenchmarkRow row;
+    row.family = family;
+    row.n = instance.n;
+    row.capacity = instance.capacity;
+    row.solver = solver.name;
+
+    JobLimits limits;
+    if (settings.time_limit_ms > 0)
+        limits.time_limit_ms = settings.time_limit_ms * (settings.warmup + settings.repetitions);
+    JobOutcome outcome = runIsolatedJob([&](std::string &output)
+    {
+        return measureSolver(solver, instance, settings, output);
+    }, limits);
+    if (outcome.status != JobStatus::Finished)
+    {
+        row.status = jobStatusName(outcome.status);
+        return row;
+    }
+
+    std::istringstream in(outcome.output);
+    in >> row.status;
+    if (row.status == "ok")
+        in >> row.profit >> row.optimal;
+    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    std::getline(in, row.message);
+    TimingSample run;
+    while (in >> run.wall_ms >> run.user_ms >> run.sys_ms)
+        row.runs.push_back(run);
+    summarize(row);
+    return row;
+}
+
+static std::string csvField(const std::string &text)
+{
+    if (text.find_first_of(",\"\n") == std::string::npos)
+        return text;
+    std::string quoted = "\"";
+    for (char c : text)
+        quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return quoted + "\"";
+}
+
+// the benchmark links only the solvers, so it quotes its own JSON strings
+static std::string jsonField(const std::string &text)
+{
+    std::string quoted = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        quoted += static_cast<unsigned char>(c) < 0x20 ? ' ' : c;
+    }
+    return quoted + "\"";
+}
+
+static void writeCsv(std::ostream &out, const std::vector<BenchmarkRow> &rows, const BenchmarkSettings &settings)
+{
+    out << "family,n,range,seed,capacity,solver,status,profit,optimal,runs,median_ms,p95_ms,min_ms,user_ms,sys_ms,message\n";
+    out << std::fixed << std::setprecision(4);
+    for (const BenchmarkRow &row : rows)
+    {
+        out << row.family << "," << row.n << "," << settings.generator.range << "," << settings.generator.seed << ","
+            << row.capacity << "," << row.solver << "," << row.status << "," << row.profit << ","
+            << (row.optimal ? 1 : 0) << "," << row.runs.size() << "," << row.median_ms << "," << row.p95_ms << ","
+            << row.min_ms << "," << row.user_ms << "," << row.sys_ms << "," << csvField(row.message) << "\n";
+    }
+}
+
+static void writeJson(std::ostream &out, const std::vector<BenchmarkRow> &rows, const BenchmarkSettings &settings)
+{
+    out << std::fixed << std::setprecision(4);
+    out << "{\"settings\":{\"range\":" << settings.generator.range << ",\"seed\":" << settings.generator.seed
+        << ",\"capacity_fraction\":" << settings.generator.capacity_fraction
+        << ",\"repetitions\":" << settings.repetitions << ",\"warmup\":" << settings.warmup
+        << ",\"time_limit_ms\":" << settings.time_limit_ms << ",\"budget_ms\":" << settings.budget_ms
+        << "},\"results\":[";
+    for (size_t k = 0; k < rows.size(); k++)
+    {
+        const BenchmarkRow &row = rows[k];
+        out << (k == 0 ? "" : ",") << "\n{\"family\":" << jsonField(row.family) << ",\"n\":" << row.n
+            << ",\"capacity\":" << row.capacity << ",\"solver\":" << jsonField(row.solver)
+            << ",\"status\":" << jsonField(row.status);
+        if (!row.message.empty())
+            out << ",\"message\":" << jsonField(row.message);
+        if (row.status == "ok")
+        {
+            out << ",\"profit\":" << row.profit << ",\"optimal\":" << (row.optimal ? "true" : "false")
+                << ",\"runs\":" << row.runs.size() << ",\"median_ms\":" << row.median_ms
+                << ",\"p95_ms\":" << row.p95_ms << ",\"min_ms\":" << row.min_ms
+                << ",\"user_ms\":" << row.user_ms << ",\"sys_ms\":" << row.sys_ms;
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+}
+
+static bool writeReport(const std::string &path, const std::vector<BenchmarkRow> &rows,
+                        const BenchmarkSettings &settings,
+                        void (*write)(std::ostream &, const std::vector<BenchmarkRow> &, const BenchmarkSettings &))
+{
+    if (path == "-")
+    {
+        write(std::cout, rows, settings);
+        return true;
+    }
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Cannot write " << path << "\n";
+        return false;
+    }
+    write(file, rows, settings);
+    return static_cast<bool>(file);
+}
+
+// scales each linear coefficient by the median ratio of measured to predicted time of its solver;
+// the report goes to the table's stream, so it never mixes with CSV or JSON on stdout
+static bool calibrate(const std::vector<BenchmarkRow> &rows, const std::string &path, std::ostream &out)
+{
+    static const std::pair<const char *, double CostModel::*> LINEAR_COEFFICIENTS[] = {
+        {"bf", &CostModel::bf_ns_per_subset},
+        {"mitm", &CostModel::mitm_ns_per_subset},
+        {"dp", &CostModel::dp_ns_per_cell},
+        {"bb", &CostModel::bb_ns_per_node},
+    };
+
+    CostModel model = activeCostModel();
+    out << "\nCalibration:\n";
+    for (const auto &[solver, member] : LINEAR_COEFFICIENTS)
+    {
+        std::vector<double> ratios;
+        for (const BenchmarkRow &row : rows)
+        {
+            if (row.solver == solver && row.status == "ok" && row.predicted_ms > 0 && row.median_ms >= CALIBRATION_MIN_MS)
+                ratios.push_back(row.median_ms / row.predicted_ms);
+        }
+        if (ratios.empty())
+        {
+            out << "  " << solver << ": no usable runs, coefficient kept at " << model.*member << "\n";
+            continue;
+        }
+        double fitted = model.*member * median(ratios);
+        out << "  " << solver << ": " << model.*member << " -> " << fitted << " ns per unit ("
+                  << ratios.size() << " instances)\n";
+        model.*member = fitted;
+    }
+
+    if (!saveCostModel(path, model))
+    {
+        std::cerr << "Cannot write " << path << "\n";
+        return false;
+    }
+    out << "Cost model written to " << path << "\n";
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkSettings settings;
+    if (!parseArguments(argc, argv, settings))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    ProgressBar::setHeadless(true);
+
+    std::ostream &table = settings.csv_path == "-" || settings.json_path == "-" ? std::cerr : std::cout;
+    table << std::left << std::setw(16) << "family" << std::setw(8) << "n" << std::setw(14) << "solver"
+          << std::setw(10) << "status" << std::setw(12) << "profit" << std::setw(13) << "median (ms)"
+          << std::setw(11) << "p95 (ms)" << std::setw(11) << "user (ms)" << "sys (ms)\n";
+    table << std::string(104, '-') << "\n";
+
+    std::vector<BenchmarkRow> rows;
+    bool disagreement = false;
+    for (InstanceFamily family : settings.families)
+    {
+        for (unsigned int n : settings.sizes)
+        {
+            GeneratorSettings generator = settings.generator;
+            generator.n = n;
+            Instance generated = generateInstance(family, generator);
+            InstanceView instance = generated.view();
+
+            // predictions of the active cost model, for --calibrate
+            std::map<std::string, double> predicted;
+            for (const auto &[name, ms] : chooseSolver(instance, std::numeric_limits<double>::infinity(),
+                                                       activeCostModel()).estimates)
+                predicted[name] = ms;
+
+            long long optimum = -1;
+            for (const std::string &name : settings.solvers)
+            {
+                BenchmarkRow row = runCell(familyName(family), instance, *findSolver(name), settings);
+                row.predicted_ms = predicted.count(name) ? predicted[name] : 0.0;
+
+                table << std::left << std::setw(16) << row.family << std::setw(8) << row.n << std::setw(14)
+                      << row.solver << std::setw(10) << row.status;
+                if (row.status == "ok")
+                {
+                    table << std::setw(12) << (std::to_string(row.profit) + (row.optimal ? "*" : ""))
+                          << std::fixed << std::setprecision(3) << std::setw(13) << row.median_ms
+                          << std::setw(11) << row.p95_ms << std::setw(11) << row.user_ms << row.sys_ms;
+                }
+                else if (!row.message.empty())
+                {
+                    table << row.message;
+                }
+                table << "\n";
+
+                if (row.status == "ok" && row.optimal)
+                {
+                    if (optimum >= 0 && optimum != row.profit)
+                    {
+                        std::cerr << "Disagreement on " << row.family << " n=" << n << ": " << row.solver
+                                  << " found " << row.profit << ", another exact solver " << optimum << "\n";
+                        disagreement = true;
+                    }
+                    optimum = row.profit;
+                }
+                rows.push_back(row);
+            }
+        }
+    }
+    table << "* proven optimal; times are over " << settings.repetitions << " runs after " << settings.warmup
+          << " warmup run(s)\n";
+
+    bool written = true;
+    if (!settings.csv_path.empty())
+        written = writeReport(settings.csv_path, rows, settings, writeCsv) && written;
+    if (!settings.json_path.empty())
+        written = writeReport(settings.json_path, rows, settings, writeJson) && written;
+    if (!settings.calibrate_path.empty())
+        written = calibrate(rows, settings.calibrate_path, table) && written;
+
+    if (!written)
+        return 3;
+    return disagreement ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file SolverCrossCheck.cpp
+ * @brief Compares every exact solver with a brute-force optimum on small random instances
+ *
+ * Usage: ./solver_crosscheck [instances] [seed] [max n]
+ *
+ * Instances have up to max n (default: 12) pallets with small weights and profits, about a fifth
+ * of them weightless and some worthless, a random capacity and, on every other instance, a random
+ * pallet limit. Every exact registry solver that runs on an instance (and enforces its pallet
+ * limit, when there is one) must reach the brute-force optimum with a loading that respects the
+ * truck; the first mismatches are printed with the instance and the exit code is 1.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include "../Approaches/SolverRegistry.h"
+#include "../Output/ProgressBar.h"
+#include "../ReadData/Instance.h"
+
+static const unsigned int DEFAULT_INSTANCES = 20000;
+static const unsigned int DEFAULT_MAX_PALLETS = 12;
+static const unsigned int MISMATCHES_SHOWN = 10;
+
+// best profit over all subsets that fit the capacity and the pallet limit
+static unsigned int bruteForceOptimum(const InstanceView &instance)
+{
+    unsigned int best = 0;
+    for (unsigned long long subset = 0; subset < (1ull << instance.n); subset++)
+    {
+        unsigned long long weight = 0, profit = 0;
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < instance.n; i++)
+        {
+            if (subset >> i & 1)
+            {
+                weight += instance.weights[i];
+                profit += instance.profits[i];
+                count++;
+            }
+        }
+        if (weight <= instance.capacity && (instance.max_pallets == 0 || count <= instance.max_pallets))
+            best = std::max<unsigned int>(best, profit);
+    }
+    return best;
+}
+
+// what is wrong with a result reported as optimal, or "" when nothing is
+static std::string checkLoading(const InstanceView &instance, const SolverResult &result, unsigned int optimum)
+{
+    unsigned long long weight = 0, profit = 0;
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < instance.n && i < result.used_pallets.size(); i++)
+    {
+        if (result.used_pallets[i])
+        {
+            weight += instance.weights[i];
+            profit += instance.profits[i];
+            count++;
+        }
+    }
+    if (result.total_profit != optimum)
+        return "profit " + std::to_string(result.total_profit) + ", optimum " + std::to_string(optimum);
+    if (profit != result.total_profit)
+        return "selected pallets sum to profit " + std::to_string(profit);
+    if (weight > instance.capacity)
+        return "selected pallets weigh " + std::to_string(weight);
+    if (instance.max_pallets != 0 && count > instance.max_pallets)
+        return "selected " + std::to_string(count) + " pallets";
+    return "";
+}
+
+static void printInstance(const InstanceView &instance)
+{
+    std::cout << "  W=" << instance.capacity << " max_pallets=" << instance.max_pallets << " w={";
+    for (unsigned int i = 0; i < instance.n; i++)
+        std::cout << (i ? "," : "") << instance.weights[i];
+    std::cout << "} p={";
+    for (unsigned int i = 0; i < instance.n; i++)
+        std::cout << (i ? "," : "") << instance.profits[i];
+    std::cout << "}\n";
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int instances = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : DEFAULT_INSTANCES;
+    unsigned int seed = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1;
+    unsigned int maxPallets = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : DEFAULT_MAX_PALLETS;
+    if (maxPallets < 1 || maxPallets > 20)
+    {
+        std::cerr << "max n must be between 1 and 20\n";
+        return 2;
+    }
+    ProgressBar::setHeadless(true);
+
+    std::mt19937 rng(seed);
+    SolverOptions options;
+    options.time_budget_ms = 10.0;
+    unsigned int mismatches = 0;
+    unsigned long long checks = 0;
+    std::map<std::string, unsigned int> mismatchesBySolver;
+    for (unsigned int k = 0; k < instances; k++)
+    {
+        Instance generated;
+        unsigned int n = std::uniform_int_distribution<unsigned int>(1, maxPallets)(rng);
+        unsigned long long weightSum = 0;
+        for (unsigned int i = 0; i < n; i++)
+        {
+            // weightless pallets are legal input and the classic way to break ratio orders
+            unsigned int weight = rng() % 5 == 0 ? 0 : std::uniform_int_distribution<unsigned int>(1, 10)(rng);
+            unsigned int profit = std::uniform_int_distribution<unsigned int>(0, 10)(rng);
+            generated.push_back(i + 1, weight, profit);
+            weightSum += weight;
+        }
+        generated.capacity = std::uniform_int_distribution<unsigned long long>(1, weightSum + 1)(rng);
+        if (k % 2 == 1)
+            generated.max_pallets = std::uniform_int_distribution<unsigned int>(1, n)(rng);
+
+        InstanceView instance = generated.view();
+        unsigned int optimum = bruteForceOptimum(instance);
+        for (const SolverInfo &solver : solverRegistry())
+        {
+            if (!solver.exact || (instance.max_pallets != 0 && !solver.enforces_pallet_limit))
+                continue;
+            SolverResult result = runSolver(solver, instance, options);
+            if (!result.ran || !result.optimal)
+                continue;
+            checks++;
+            std::string problem = checkLoading(instance, result, optimum);
+            if (problem.empty())
+                continue;
+            mismatchesBySolver[solver.name]++;
+            if (mismatches++ < MISMATCHES_SHOWN)
+            {
+                std::cout << solver.name << ": " << problem << "\n";
+                printInstance(instance);
+            }
+        }
+    }
+
+    std::cout << instances << " instances, " << checks << " solver results checked, " << mismatches
+              << " mismatches\n";
+    for (const auto &[name, count] : mismatchesBySolver)
+        std::cout << "  " << name << ": " << count << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file SortBenchmark.cpp
+ * @brief Compares std::sort with the radix sort backend used by the greedy approaches
+ *
+ * Usage: ./sort_benchmark [n ...]
+ *
+ * For every n, generates an uncorrelated and a correlated instance and times
+ * both orderings (by profit and by profit-to-weight ratio) with each backend.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Approaches/RadixSort.h"
+
+static const unsigned int COEFFICIENT_RANGE = 10000;
+static const int REPETITIONS = 5;
+
+struct GeneratedInstance
+{
+    std::vector<unsigned int> weights;
+    std::vector<unsigned int> profits;
+};
+
+static GeneratedInstance generate(unsigned int n, bool correlated, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<unsigned int> coefficient(1, COEFFICIENT_RANGE);
+
+    GeneratedInstance instance;
+    instance.weights.resize(n);
+    instance.profits.resize(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        instance.weights[i] = coefficient(rng);
+        // correlated: profit follows weight plus a fixed margin, so ratios are close together
+        instance.profits[i] = correlated ? instance.weights[i] + COEFFICIENT_RANGE / 10 : coefficient(rng);
+    }
+    return instance;
+}
+
+// same ordering as the comparison sort in knapsackGreedyProfit
+static std::vector<unsigned int> stdSortByProfit(const GeneratedInstance &instance)
+{
+    unsigned int n = instance.profits.size();
+    std::vector<std::pair<unsigned int, unsigned int>> items(n);
+    for (unsigned int i = 0; i < n; i++)
+        items[i] = std::make_pair(i, instance.profits[i]);
+    std::sort(items.begin(), items.end(),
+              [](const std::pair<unsigned int, unsigned int> &a,
+                 const std::pair<unsigned int, unsigned int> &b)
+              {
+                  if (a.second != b.second)
+                      return a.second > b.second;
+                  return a.first < b.first;
+              });
+    std::vector<unsigned int> order(n);
+    for (unsigned int i = 0; i < n; i++)
+        order[i] = items[i].first;
+    return order;
+}
+
+// same ordering as the comparison sort in knapsackGreedyRatio
+static std::vector<unsigned int> stdSortByRatio(const GeneratedInstance &instance)
+{
+    unsigned int n = instance.profits.size();
+    std::vector<std::pair<unsigned int, double>> items(n);
+    for (unsigned int i = 0; i < n; i++)
+        items[i] = std::make_pair(i, static_cast<double>(instance.profits[i]) / instance.weights[i]);
+    std::sort(items.begin(), items.end(),
+              [](const std::pair<unsigned int, double> &a,
+                 const std::pair<unsigned int, double> &b)
+              {
+                  if (a.second != b.second)
+                      return a.second > b.second;
+                  return a.first < b.first;
+              });
+    std::vector<unsigned int> order(n);
+    for (unsigned int i = 0; i < n; i++)
+        order[i] = items[i].first;
+    return order;
+}
+
+static std::vector<unsigned int> radixByProfit(const GeneratedInstance &instance)
+{
+    return radixSortDescending(instance.profits.data(), instance.profits.size());
+}
+
+static std::vector<unsigned int> radixByRatio(const GeneratedInstance &instance)
+{
+    unsigned int n = instance.profits.size();
+    std::vector<unsigned long long> keys(n);
+    for (unsigned int i = 0; i < n; i++)
+        keys[i] = ratioKey(instance.profits[i], instance.weights[i]);
+    return radixSortDescending(keys.data(), n);
+}
+
+// best-of-REPETITIONS wall time in milliseconds
+template <typename Sorter>
+static double timeSort(Sorter sorter, const GeneratedInstance &instance, std::vector<unsigned int> &order)
+{
+    double best = 0;
+    for (int rep = 0; rep < REPETITIONS; rep++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        order = sorter(instance);
+        auto end = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+        if (rep == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<unsigned int> sizes;
+    for (int i = 1; i < argc; i++)
+        sizes.push_back(static_cast<unsigned int>(std::strtoul(argv[i], nullptr, 10)));
+    if (sizes.empty())
+        sizes = {100000, 1000000, 4000000};
+
+    std::cout << std::left << std::setw(12) << "n"
+              << std::setw(14) << "instance"
+              << std::setw(8) << "key"
+              << std::setw(16) << "std::sort (ms)"
+              << std::setw(13) << "radix (ms)"
+              << std::setw(10) << "speedup"
+              << "same order\n";
+    std::cout << std::string(80, '-') << "\n";
+
+    for (unsigned int n : sizes)
+    {
+        for (bool correlated : {false, true})
+        {
+            GeneratedInstance instance = generate(n, correlated, 42);
+            const char *family = correlated ? "correlated" : "uncorrelated";
+
+            std::vector<unsigned int> expected, actual;
+            double stdProfit = timeSort(stdSortByProfit, instance, expected);
+            double radixProfit = timeSort(radixByProfit, instance, actual);
+            bool sameProfitOrder = (expected == actual);
+
+            double stdRatio = timeSort(stdSortByRatio, instance, expected);
+            double radixRatio = timeSort(radixByRatio, instance, actual);
+            bool sameRatioOrder = (expected == actual);
+
+            std::cout << std::fixed << std::setprecision(2)
+                      << std::setw(12) << n << std::setw(14) << family << std::setw(8) << "profit"
+                      << std::setw(16) << stdProfit << std::setw(13) << radixProfit
+                      << std::setw(10) << stdProfit / radixProfit
+                      << (sameProfitOrder ? "yes" : "no") << "\n";
+            std::cout << std::setw(12) << n << std::setw(14) << family << std::setw(8) << "ratio"
+                      << std::setw(16) << stdRatio << std::setw(13) << radixRatio
+                      << std::setw(10) << stdRatio / radixRatio
+                      << (sameRatioOrder ? "yes" : "no") << "\n";
+        }
+    }
+    return 0;
+}
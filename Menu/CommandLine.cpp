@@ -0,0 +1,557 @@
+#include "CommandLine.h"
+#include "../Approaches/SolverRegistry.h"
+#include "../Approaches/SolverSelection.h"
+#include "../Output/Output.h"
+#include "../Output/ProgressBar.h"
+#include "../ReadData/BinaryInstance.h"
+#include "../ReadData/read.h"
+#include "../Utils/BatchRunner.h"
+#include "../Utils/LoadGenerator.h"
+#include "../Utils/SolutionCache.h"
+#include "../Utils/SolveServer.h"
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Everything the command line asked for.
+ */
+struct CommandLineArgs
+{
+    std::vector<std::string> solvers;
+    std::string truckFile;
+    std::string palletFile;
+    std::string binaryFile;
+    std::string batchDirectory;
+    std::string outputFile;
+    std::string costModelFile;
+    bool json = false;
+    bool overrideMaxPallets = false;
+    unsigned int maxPallets = 0;
+    bool threadsGiven = false;
+    SolverOptions options;
+    unsigned int jobs = 0;
+    JobLimits limits;
+    std::string serveSocket;
+    std::string loadgenSocket;
+    unsigned int workers = 0;
+    LoadGenOptions load;
+    bool sendPaths = false;
+    std::string cacheDirectory;
+    bool noCache = false;
+};
+
+static void printUsage(std::ostream &out, const char *program)
+{
+    out << "Usage: " << program << " --solver LIST (--truck FILE --pallets FILE | --kbin FILE) [options]\n"
+        << "       " << program << " --solver LIST --batch DIR [--jobs N] [--time-limit MS] [--memory-limit MB] [options]\n"
+        << "       " << program << " --serve SOCKET [--workers N] [--cache-dir DIR | --no-cache]\n"
+        << "       " << program << " --loadgen SOCKET --solver LIST (--truck FILE --pallets FILE | --kbin FILE)"
+        << " [--clients C] [--requests N] [--pipeline D] [--send-paths]\n"
+        << "       " << program << " --list\n"
+        << "Runs the given solvers without the interactive menu.\n\n"
+        << "  --solver LIST     comma-separated solver names, or \"all\"\n"
+        << "  --truck FILE      TruckAndPallets CSV (with --pallets)\n"
+        << "  --pallets FILE    Pallets CSV (with --truck)\n"
+        << "  --kbin FILE       binary instance (.kbin) instead of the CSV pair\n"
+        << "  --batch DIR       every TruckAndPallets_X.csv / Pallets_X.csv pair of DIR, one result line each\n"
+        << "  --jobs N          instances solved at once in batch mode (default: all cores)\n"
+        << "  --time-limit MS   wall-clock limit per batch instance (default: none)\n"
+        << "  --memory-limit MB memory limit per batch instance (default: none)\n"
+        << "  --serve SOCKET    serve solve requests on a Unix domain socket until Ctrl+C\n"
+        << "  --workers N       solver threads of the server (default: all cores)\n"
+        << "  --loadgen SOCKET  send the instance to a server over and over and report the latencies\n"
+        << "  --clients C       concurrent load generator connections (default 1)\n"
+        << "  --requests N      requests per load generator connection (default 100)\n"
+        << "  --pipeline D      unanswered requests allowed per connection (default 1)\n"
+        << "  --send-paths      send the file paths instead of the pallets\n"
+        << "  --cache-dir DIR   keep proven-optimal results in DIR and reuse them for identical instances\n"
+        << "  --no-cache        make the server solve every request (it caches in memory by default)\n"
+        << "  --max-pallets K   override the pallet limit of the instance (0 for no limit)\n"
+        << "  --budget MS       time budget of local search and simulated annealing, and the longest\n"
+        << "                    predicted run \"auto\" accepts from an exact solver (default "
+        << SolverOptions().time_budget_ms << ")\n"
+        << "  --threads N       threads for the parallel solvers (default: all cores, 1 in batch mode)\n"
+        << "  --json            write JSON instead of text\n"
+        << "  --output FILE     write the results to FILE instead of stdout\n"
+        << "  --cost-model FILE coefficients the \"auto\" solver predicts run times with\n"
+        << "  --list            list the solvers and exit\n"
+        << "  --help            show this message and exit\n\n"
+        << "Exit status: " << CLI_EXIT_OK << " ok, " << CLI_EXIT_OUTPUT_ERROR << " output error, "
+        << CLI_EXIT_USAGE_ERROR << " usage error, " << CLI_EXIT_INPUT_ERROR << " input error, "
+        << CLI_EXIT_SOLVER_SKIPPED << " some solver was skipped, " << CLI_EXIT_BATCH_FAILURES
+        << " some batch instance failed, " << CLI_EXIT_SERVER_ERROR << " server or connection error.\n";
+}
+
+static void printSolverList(std::ostream &out)
+{
+    for (const SolverInfo &solver : solverRegistry())
+    {
+        out << std::string(solver.name) << std::string(16 - std::string(solver.name).size(), ' ')
+            << solver.description << (solver.exact ? " (exact)" : "") << "\n";
+    }
+}
+
+static std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+            items.push_back(item);
+    }
+    return items;
+}
+
+static bool parseUnsigned(const std::string &text, unsigned long long &value)
+{
+    try
+    {
+        size_t used = 0;
+        value = std::stoull(text, &used);
+        return used == text.size() && text[0] != '-';
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+}
+
+// returns false, after printing why, if the arguments are not usable
+static bool parseArguments(int argc, char *argv[], CommandLineArgs &args)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string flag = argv[i];
+        bool takesValue = flag == "--solver" || flag == "--truck" || flag == "--pallets" || flag == "--kbin" ||
+                          flag == "--max-pallets" || flag == "--budget" || flag == "--threads" || flag == "--output" ||
+                          flag == "--batch" || flag == "--jobs" || flag == "--time-limit" || flag == "--memory-limit" ||
+                          flag == "--serve" || flag == "--workers" || flag == "--loadgen" || flag == "--clients" ||
+                          flag == "--requests" || flag == "--pipeline" || flag == "--cache-dir" ||
+                          flag == "--cost-model";
+        if (takesValue && i + 1 >= argc)
+        {
+            std::cerr << "Missing value after " << flag << std::endl;
+            return false;
+        }
+
+        unsigned long long number = 0;
+        if (flag == "--solver")
+        {
+            for (const std::string &name : splitList(argv[++i]))
+            {
+                if (name == "all")
+                {
+                    for (const SolverInfo &solver : solverRegistry())
+                        args.solvers.push_back(solver.name);
+                }
+                else
+                {
+                    args.solvers.push_back(name);
+                }
+            }
+        }
+        else if (flag == "--truck")
+            args.truckFile = argv[++i];
+        else if (flag == "--pallets")
+            args.palletFile = argv[++i];
+        else if (flag == "--kbin")
+            args.binaryFile = argv[++i];
+        else if (flag == "--batch")
+            args.batchDirectory = argv[++i];
+        else if (flag == "--output")
+            args.outputFile = argv[++i];
+        else if (flag == "--cost-model")
+            args.costModelFile = argv[++i];
+        else if (flag == "--serve")
+            args.serveSocket = argv[++i];
+        else if (flag == "--loadgen")
+            args.loadgenSocket = argv[++i];
+        else if (flag == "--send-paths")
+            args.sendPaths = true;
+        else if (flag == "--cache-dir")
+            args.cacheDirectory = argv[++i];
+        else if (flag == "--no-cache")
+            args.noCache = true;
+        else if (flag == "--json")
+            args.json = true;
+        else if (flag == "--max-pallets" || flag == "--threads" || flag == "--jobs" || flag == "--memory-limit" ||
+                 flag == "--workers" || flag == "--clients" || flag == "--requests" || flag == "--pipeline")
+        {
+            if (!parseUnsigned(argv[++i], number) || number > UINT_MAX)
+            {
+                std::cerr << "Invalid number for " << flag << ": " << argv[i] << std::endl;
+                return false;
+            }
+            if (flag == "--threads")
+            {
+                args.options.threads = number;
+                args.threadsGiven = true;
+            }
+            else if (flag == "--jobs")
+                args.jobs = number;
+            else if (flag == "--memory-limit")
+                args.limits.memory_limit_bytes = number << 20;
+            else if (flag == "--workers")
+                args.workers = number;
+            else if (flag == "--clients")
+                args.load.clients = number;
+            else if (flag == "--requests")
+                args.load.requests = number;
+            else if (flag == "--pipeline")
+                args.load.pipeline = number;
+            else
+            {
+                args.overrideMaxPallets = true;
+                args.maxPallets = number;
+            }
+        }
+        else if (flag == "--budget" || flag == "--time-limit")
+        {
+            double &milliseconds = flag == "--budget" ? args.options.time_budget_ms : args.limits.time_limit_ms;
+            try
+            {
+                milliseconds = std::stod(argv[++i]);
+            }
+            catch (const std::exception &)
+            {
+                milliseconds = -1.0;
+            }
+            if (milliseconds < 0.0)
+            {
+                std::cerr << "Invalid time for " << flag << ": " << argv[i] << std::endl;
+                return false;
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << flag << std::endl;
+            return false;
+        }
+    }
+
+    bool csv = !args.truckFile.empty() || !args.palletFile.empty();
+    int sources = csv + !args.binaryFile.empty() + !args.batchDirectory.empty();
+    if (args.noCache && (args.serveSocket.empty() || !args.cacheDirectory.empty()))
+    {
+        std::cerr << "--no-cache only applies to --serve, without --cache-dir" << std::endl;
+        return false;
+    }
+    if (!args.loadgenSocket.empty() && !args.cacheDirectory.empty())
+    {
+        std::cerr << "--cache-dir goes to the server, not to --loadgen" << std::endl;
+        return false;
+    }
+    if (!args.serveSocket.empty())
+    {
+        // the instances and solvers come with the requests
+        if (sources != 0 || !args.solvers.empty() || !args.loadgenSocket.empty())
+        {
+            std::cerr << "--serve takes no instance and no solver, they come with each request" << std::endl;
+            return false;
+        }
+        return true;
+    }
+    if (args.workers != 0)
+    {
+        std::cerr << "--workers only applies to --serve" << std::endl;
+        return false;
+    }
+    if (args.loadgenSocket.empty() && (args.sendPaths || args.load.clients != LoadGenOptions().clients ||
+                                       args.load.requests != LoadGenOptions().requests ||
+                                       args.load.pipeline != LoadGenOptions().pipeline))
+    {
+        std::cerr << "--clients, --requests, --pipeline and --send-paths only apply to --loadgen" << std::endl;
+        return false;
+    }
+    if (!args.loadgenSocket.empty() && !args.batchDirectory.empty())
+    {
+        std::cerr << "--loadgen needs one instance (--truck and --pallets, or --kbin), not --batch" << std::endl;
+        return false;
+    }
+
+    if (args.solvers.empty())
+    {
+        std::cerr << "No solver given (use --solver, --list shows the names)" << std::endl;
+        return false;
+    }
+    for (const std::string &name : args.solvers)
+    {
+        if (findSolver(name) == nullptr)
+        {
+            std::cerr << "Unknown solver: " << name << " (--list shows the names)" << std::endl;
+            return false;
+        }
+    }
+
+    if (sources != 1 || (csv && (args.truckFile.empty() || args.palletFile.empty())))
+    {
+        std::cerr << "Give either --truck and --pallets, --kbin or --batch" << std::endl;
+        return false;
+    }
+    bool batchOnly = args.jobs != 0 || args.limits.time_limit_ms > 0 || args.limits.memory_limit_bytes != 0;
+    if (batchOnly && args.batchDirectory.empty())
+    {
+        std::cerr << "--jobs, --time-limit and --memory-limit only apply to --batch" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void writeResults(std::ostream &out, const CommandLineArgs &args, const InstanceView &instance,
+                         const std::vector<SolverResult> &results)
+{
+    if (!args.json)
+    {
+        out << "Instance: " << (args.binaryFile.empty() ? args.palletFile : args.binaryFile)
+            << "  pallets " << instance.n << "  capacity " << instance.capacity;
+        if (instance.volumes != nullptr)
+            out << "  volume " << instance.volume_capacity;
+        if (instance.max_pallets != 0)
+            out << "  pallet limit " << instance.max_pallets;
+        out << "\n";
+        for (const SolverResult &result : results)
+            OutputSolverResultText(out, instance, result);
+        return;
+    }
+
+    out << "{\"instance\":{";
+    if (args.binaryFile.empty())
+        out << "\"truck\":" << jsonQuote(args.truckFile) << ",\"pallets\":" << jsonQuote(args.palletFile);
+    else
+        out << "\"kbin\":" << jsonQuote(args.binaryFile);
+    out << ",\"n\":" << instance.n << ",\"capacity\":" << instance.capacity;
+    if (instance.volumes != nullptr)
+        out << ",\"volume_capacity\":" << instance.volume_capacity;
+    out << ",\"max_pallets\":" << instance.max_pallets << "},\"results\":[";
+    for (size_t k = 0; k < results.size(); k++)
+    {
+        out << (k == 0 ? "" : ",");
+        OutputSolverResultJson(out, instance, results[k]);
+    }
+    out << "]}\n";
+}
+
+static int runBatchCommand(const CommandLineArgs &args, std::ostream &out)
+{
+    std::vector<BatchEntry> entries = scanBatchDirectory(args.batchDirectory);
+    if (entries.empty())
+    {
+        std::cerr << "No TruckAndPallets_X.csv / Pallets_X.csv pairs in " << args.batchDirectory << std::endl;
+        return CLI_EXIT_INPUT_ERROR;
+    }
+    if (args.overrideMaxPallets)
+        std::cerr << "Note: --max-pallets does not apply to --batch, each instance keeps its own limit" << std::endl;
+
+    BatchOptions options;
+    options.solvers = args.solvers;
+    options.solver_options = args.options;
+    // the pool already keeps every core busy
+    if (!args.threadsGiven)
+        options.solver_options.threads = 1;
+    options.jobs = args.jobs;
+    options.limits = args.limits;
+    options.json = args.json;
+    // each instance runs in its own process, so only the directory is worth sharing
+    std::unique_ptr<SolutionCache> cache;
+    if (!args.cacheDirectory.empty())
+        cache = std::make_unique<SolutionCache>(SOLUTION_CACHE_DEFAULT_BYTES, args.cacheDirectory);
+    options.cache = cache.get();
+
+    BatchSummary summary = runBatch(entries, options, out);
+    std::cerr << summary.instances << " instances, " << summary.failed << " failed, " << summary.skipped
+              << " with skipped solvers, " << summary.elapsed_ms / 1000.0 << " s" << std::endl;
+
+    if (!out)
+    {
+        std::cerr << "Failed to write the results" << std::endl;
+        return CLI_EXIT_OUTPUT_ERROR;
+    }
+    if (summary.failed > 0)
+        return CLI_EXIT_BATCH_FAILURES;
+    return summary.skipped > 0 ? CLI_EXIT_SOLVER_SKIPPED : CLI_EXIT_OK;
+}
+
+static int runLoadGeneratorCommand(const CommandLineArgs &args, std::ostream &out)
+{
+    SolveRequest request;
+    request.solvers = args.solvers;
+    request.options = args.options;
+    if (args.sendPaths)
+    {
+        // the server may run from another directory
+        request.kind = args.binaryFile.empty() ? RequestKind::CsvPaths : RequestKind::BinaryPath;
+        if (args.binaryFile.empty())
+        {
+            request.truck_file = std::filesystem::absolute(args.truckFile).string();
+            request.pallet_file = std::filesystem::absolute(args.palletFile).string();
+        }
+        else
+        {
+            request.pallet_file = std::filesystem::absolute(args.binaryFile).string();
+        }
+    }
+    else if (args.binaryFile.empty())
+    {
+        if (!readInstance(args.truckFile, args.palletFile, request.instance))
+            return CLI_EXIT_INPUT_ERROR;
+    }
+    else
+    {
+        BinaryInstance binary(args.binaryFile);
+        if (!binary.isValid())
+        {
+            std::cerr << "Cannot load " << args.binaryFile << ": " << binary.error() << std::endl;
+            return CLI_EXIT_INPUT_ERROR;
+        }
+        InstanceView view = binary.view();
+        request.instance.capacity = view.capacity;
+        request.instance.max_pallets = view.max_pallets;
+        request.instance.reserve(view.n);
+        for (unsigned int i = 0; i < view.n; i++)
+            request.instance.push_back(view.pallets[i], view.weights[i], view.profits[i]);
+    }
+    if (args.overrideMaxPallets)
+        request.instance.max_pallets = args.maxPallets;
+
+    LoadGenStats stats;
+    bool ok = runLoadGenerator(args.loadgenSocket, request, args.load, stats);
+    double seconds = stats.elapsed_ms / 1000.0;
+    double throughput = seconds > 0 ? stats.answered / seconds : 0.0;
+    if (args.json)
+    {
+        out << "{\"sent\":" << stats.sent << ",\"answered\":" << stats.answered << ",\"errors\":" << stats.errors
+            << ",\"elapsed_ms\":" << stats.elapsed_ms << ",\"requests_per_s\":" << throughput
+            << ",\"mean_ms\":" << stats.mean_ms << ",\"p50_ms\":" << stats.p50_ms << ",\"p99_ms\":" << stats.p99_ms
+            << ",\"max_ms\":" << stats.max_ms << "}\n";
+    }
+    else
+    {
+        out << "Sent " << stats.sent << ", answered " << stats.answered << ", errors " << stats.errors << " in "
+            << seconds << " s (" << throughput << " requests/s)\n"
+            << "Latency ms: mean " << stats.mean_ms << "  p50 " << stats.p50_ms << "  p99 " << stats.p99_ms
+            << "  max " << stats.max_ms << "\n";
+        if (!stats.first_body.empty())
+            out << "First answer: " << stats.first_body << "\n";
+    }
+
+    if (!ok)
+    {
+        std::cerr << "Could not connect to " << args.loadgenSocket << ", or the server closed a connection" << std::endl;
+        return CLI_EXIT_SERVER_ERROR;
+    }
+    return stats.errors > 0 ? CLI_EXIT_SERVER_ERROR : CLI_EXIT_OK;
+}
+
+int runCommandLine(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string flag = argv[i];
+        if (flag == "--help" || flag == "-h")
+        {
+            printUsage(std::cout, argv[0]);
+            return CLI_EXIT_OK;
+        }
+        if (flag == "--list")
+        {
+            printSolverList(std::cout);
+            return CLI_EXIT_OK;
+        }
+    }
+
+    CommandLineArgs args;
+    if (!parseArguments(argc, argv, args))
+    {
+        printUsage(std::cerr, argv[0]);
+        return CLI_EXIT_USAGE_ERROR;
+    }
+
+    ProgressBar::setHeadless(true);
+
+    if (!args.costModelFile.empty())
+    {
+        CostModel model = activeCostModel();
+        std::string error;
+        if (!loadCostModel(args.costModelFile, model, error))
+        {
+            std::cerr << "Cannot load the cost model: " << error << std::endl;
+            return CLI_EXIT_INPUT_ERROR;
+        }
+        setActiveCostModel(model);
+    }
+
+    std::ofstream file;
+    if (!args.outputFile.empty())
+    {
+        file.open(args.outputFile, std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open file: " << args.outputFile << std::endl;
+            return CLI_EXIT_OUTPUT_ERROR;
+        }
+    }
+    std::ostream &out = args.outputFile.empty() ? std::cout : file;
+
+    std::unique_ptr<SolutionCache> cache;
+    if (!args.serveSocket.empty())
+    {
+        if (!args.noCache)
+            cache = std::make_unique<SolutionCache>(SOLUTION_CACHE_DEFAULT_BYTES, args.cacheDirectory);
+        return runSolveServer(args.serveSocket, args.workers, cache.get()) ? CLI_EXIT_OK : CLI_EXIT_SERVER_ERROR;
+    }
+    if (!args.loadgenSocket.empty())
+        return runLoadGeneratorCommand(args, out);
+    if (!args.batchDirectory.empty())
+        return runBatchCommand(args, out);
+
+    // the CSV pair is loaded into memory, a .kbin is read in place
+    Instance loaded;
+    std::unique_ptr<BinaryInstance> binary;
+    InstanceView instance;
+    if (args.binaryFile.empty())
+    {
+        if (!readInstance(args.truckFile, args.palletFile, loaded))
+            return CLI_EXIT_INPUT_ERROR;
+        instance = loaded.view();
+    }
+    else
+    {
+        binary = std::make_unique<BinaryInstance>(args.binaryFile);
+        if (!binary->isValid())
+        {
+            std::cerr << "Cannot load " << args.binaryFile << ": " << binary->error() << std::endl;
+            return CLI_EXIT_INPUT_ERROR;
+        }
+        instance = binary->view();
+    }
+    if (args.overrideMaxPallets)
+        instance.max_pallets = args.maxPallets;
+
+    if (!args.cacheDirectory.empty())
+        cache = std::make_unique<SolutionCache>(SOLUTION_CACHE_DEFAULT_BYTES, args.cacheDirectory);
+
+    std::vector<SolverResult> results;
+    bool skipped = false;
+    for (const std::string &name : args.solvers)
+    {
+        results.push_back(runSolverCached(cache.get(), *findSolver(name), instance, args.options));
+        skipped = skipped || !results.back().ran;
+    }
+
+    writeResults(out, args, instance, results);
+    out.flush();
+    if (!out)
+    {
+        std::cerr << "Failed to write the results" << std::endl;
+        return CLI_EXIT_OUTPUT_ERROR;
+    }
+    return skipped ? CLI_EXIT_SOLVER_SKIPPED : CLI_EXIT_OK;
+}
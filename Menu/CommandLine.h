@@ -0,0 +1,90 @@
+/**
+ * @file CommandLine.h
+ * @brief Non-interactive command-line front end: loads an instance, runs solvers by name, prints results
+ */
+
+#ifndef COMMANDLINE_H
+#define COMMANDLINE_H
+
+/**
+ * @brief Exit status: every requested solver ran
+ */
+const int CLI_EXIT_OK = 0;
+
+/**
+ * @brief Exit status: the output file could not be written
+ */
+const int CLI_EXIT_OUTPUT_ERROR = 1;
+
+/**
+ * @brief Exit status: bad command-line arguments or unknown solver name
+ */
+const int CLI_EXIT_USAGE_ERROR = 2;
+
+/**
+ * @brief Exit status: the instance files could not be read
+ */
+const int CLI_EXIT_INPUT_ERROR = 3;
+
+/**
+ * @brief Exit status: at least one requested solver was skipped (e.g. its table would not fit)
+ */
+const int CLI_EXIT_SOLVER_SKIPPED = 4;
+
+/**
+ * @brief Exit status: at least one batch instance could not be read, timed out, ran out of memory or crashed
+ */
+const int CLI_EXIT_BATCH_FAILURES = 5;
+
+/**
+ * @brief Exit status: the server socket could not be set up, or the load generator lost its server
+ */
+const int CLI_EXIT_SERVER_ERROR = 6;
+
+/**
+ * @brief Runs the tool without the menu, as described by the command-line arguments
+ * @param argc Argument count, as passed to main
+ * @param argv Arguments, as passed to main
+ * @return Process exit status (one of the CLI_EXIT_* constants)
+ *
+ * Usage:
+ *   DA2425_PROJ2 --solver dp,bt --truck TruckAndPallets_01.csv --pallets Pallets_01.csv [--json]
+ *   DA2425_PROJ2 --solver all --kbin instance.kbin --output results.txt
+ *   DA2425_PROJ2 --solver dp,greedy --batch ../datasets-extra --jobs 8 --time-limit 5000 --json
+ *   DA2425_PROJ2 --serve /tmp/knaptruck.sock --workers 4 --cache-dir ~/.cache/knaptruck
+ *   DA2425_PROJ2 --loadgen /tmp/knaptruck.sock --solver dp --truck T.csv --pallets P.csv --clients 4 --pipeline 8
+ *
+ * Options:
+ * - --solver LIST     comma-separated solver names, or "all" (required)
+ * - --truck FILE      TruckAndPallets CSV, used with --pallets
+ * - --pallets FILE    Pallets CSV, used with --truck
+ * - --kbin FILE       binary instance instead of the CSV pair
+ * - --batch DIR       solve every instance pair of DIR (see runBatch), one result line each
+ * - --jobs N          instances solved at once in batch mode
+ * - --time-limit MS   wall-clock limit per batch instance
+ * - --memory-limit MB memory limit per batch instance
+ * - --serve SOCKET    run the solve server on a Unix domain socket (see runSolveServer)
+ * - --workers N       solver threads of the server
+ * - --loadgen SOCKET  send the instance to a server repeatedly and report latencies (see runLoadGenerator)
+ * - --clients C       concurrent load generator connections
+ * - --requests N      requests per load generator connection
+ * - --pipeline D      unanswered requests allowed per load generator connection
+ * - --send-paths      make the load generator send file paths instead of the pallets
+ * - --cache-dir DIR   reuse proven-optimal results stored in DIR (see SolutionCache)
+ * - --no-cache        disable the server's in-memory cache
+ * - --max-pallets K   override the pallet limit of the instance (0 for no limit)
+ * - --budget MS       time budget of the anytime solvers (local search, simulated annealing), also
+ *                     the longest predicted run the "auto" solver accepts from an exact solver
+ * - --threads N       threads for the parallel solvers (1 by default in batch mode)
+ * - --json            write one JSON document instead of text
+ * - --output FILE     write the results to FILE instead of stdout
+ * - --cost-model FILE cost model coefficients for the "auto" solver (see loadCostModel)
+ * - --list            list the solver names and exit
+ * - --help            show the usage and exit
+ *
+ * @note Progress bars are switched to headless mode: nothing is drawn, stdin is never read and
+ *       nothing waits for a key press. Diagnostics go to stderr, results to stdout or the output file.
+ */
+int runCommandLine(int argc, char *argv[]);
+
+#endif // COMMANDLINE_H
@@ -7,11 +7,24 @@
 #include <iomanip>               
 #include <limits>               
 #include <cstdlib>               
+#include <sstream>
+#include <algorithm>
 #include "../Approaches/Greedy.h" 
 #include "../ReadData/read.h"
 
 using namespace std;
 
+// shows the pallet limit of the instance, or warns that the algorithm does not enforce it
+static void showPalletLimit(unsigned int maxPallets, bool enforced)
+{
+    if (maxPallets == 0)
+        return;
+    if (enforced)
+        cout << "Pallet limit: " << maxPallets << "\n";
+    else
+        cout << "Note: this algorithm ignores the limit of " << maxPallets << " pallets.\n";
+}
+
 void mainMenu()
 {
     while (true)
@@ -22,22 +35,20 @@ void mainMenu()
         cout << "========================================" << endl;
         cout << "1. Enter pallet data interactively" << endl;
         cout << "2. Use predefined dataset" << endl;
-        cout << "3: Info & Instructions" << endl;
-        cout << "4. Exit" << endl;
+        cout << "3. Load binary instance (.kbin)" << endl;
+        cout << "4. Convert predefined dataset to binary" << endl;
+        cout << "5. Verify binary instance (.kbin)" << endl;
+        cout << "6. Stream pallets (stdin or FIFO)" << endl;
+        cout << "7: Info & Instructions" << endl;
+        cout << "8. Exit" << endl;
         cout << "Option: ";
         int mainChoice;
         cin >> mainChoice;
         if (mainChoice == 1)
         {
-            unsigned int *data = interactiveDataEntry();
-            unsigned int capacity = data[0];
-            unsigned int n = data[1];
-            unsigned int *pallets = &data[3];
-            unsigned int *weights = &data[3 + n];
-            unsigned int *profits = &data[3 + 2 * n];
+            Instance instance = interactiveDataEntry();
             int option = optionsMenu();
-            handleMenuOption(option, pallets, weights, profits, n, capacity);
-            delete[] data;
+            handleMenuOption(option, instance.view());
         }
         else if (mainChoice == 2)
         {
@@ -45,16 +56,32 @@ void mainMenu()
         }
         else if (mainChoice == 3)
         {
-            optionShowInfoMenu();
+            binaryInstanceSelectionAndRun();
         }
         else if (mainChoice == 4)
+        {
+            optionConvertDatasetToBinary();
+        }
+        else if (mainChoice == 5)
+        {
+            optionVerifyBinaryInstance();
+        }
+        else if (mainChoice == 6)
+        {
+            optionStreamingMode();
+        }
+        else if (mainChoice == 7)
+        {
+            optionShowInfoMenu();
+        }
+        else if (mainChoice == 8)
         {
             cout << "Exiting..." << endl;
             exit(0);
         }
         else
         {
-            cout << "Invalid input. Please choose 1-3." << endl;
+            cout << "Invalid input. Please choose 1-8." << endl;
         }
     }
 }
@@ -80,33 +107,36 @@ int optionsMenu()
         cout << "4: Approximation Algorithm (Greedy Approach)" << endl;
         cout << "5: Linear Integer Programming" << endl;
         cout << "6: Compare All Algorithms" << endl;
-        cout << "7: Change Input Data" << endl;
-        cout << "8: Exit" << endl;
+        cout << "7: Incremental Re-solve (Edit Manifest)" << endl;
+        cout << "8: Capacity Sweep (Several Truck Sizes)" << endl;
+        cout << "9: Multi-Truck Fleet" << endl;
+        cout << "10: Weight + Volume Constraints (2D)" << endl;
+        cout << "11: Automatic Solver Choice (Cost Model)" << endl;
+        cout << "12: Change Input Data" << endl;
+        cout << "13: Exit" << endl;
         cout << "Option: ";
         cin >> i;
         cout << endl;
 
-        if (i < 1 || i > 8)
-            cout << "Invalid input. Please choose 1-9." << endl;
-    } while (i < 1 || i > 8);
+        if (i < 1 || i > 13)
+            cout << "Invalid input. Please choose 1-13." << endl;
+    } while (i < 1 || i > 13);
 
     return i;
 }
 
-void handleMenuOption(int option, unsigned int pallets[], unsigned int weights[],
-                      unsigned int profits[], unsigned int n,
-                      int capacity)
+void handleMenuOption(int option, const InstanceView &instance)
 {
     switch (option)
     {
     case 1:
-        optionExhaustiveSearch(pallets, weights, profits, n, capacity);
+        optionExhaustiveSearch(instance);
         break;
     case 2:
-        optionDynamicProgramming(pallets, weights, profits, n, capacity);
+        optionDynamicProgramming(instance);
         break;
     case 3:
-        optionBacktracking(pallets, weights, profits, n, capacity);
+        optionBacktracking(instance);
         break;
     case 4:
     {
@@ -114,50 +144,105 @@ void handleMenuOption(int option, unsigned int pallets[], unsigned int weights[]
         switch (subOption)
         {
         case 1:
-            optionGreedyRatio(pallets, weights, profits, n, capacity);
+            optionGreedyRatio(instance);
             break;
         case 2:
-            optionGreedyProfit(pallets, weights, profits, n, capacity);
+            optionGreedyProfit(instance);
             break;
         case 3:
-            optionGreedyMaximum(pallets, weights, profits, n, capacity);
+            optionGreedyMaximum(instance);
             break;
         case 4:
+            optionGreedyLocalSearch(instance);
+            break;
+        case 5:
+            optionSimulatedAnnealing(instance);
+            break;
+        case 6:
             {
                 int next_option = optionsMenu();
-                handleMenuOption(next_option, pallets, weights, profits, n, capacity);
+                handleMenuOption(next_option, instance);
             }
             break;
         }
     }
     break;
     case 5:
-        optionIntegerLinearProgramming(pallets, weights, profits, n, capacity);
-        break;
+    {
+        int subOption = integerProgrammingSubmenu();
+        switch (subOption)
+        {
+        case 1:
+            optionIntegerLinearProgramming(instance);
+            break;
+        case 2:
+            optionIntegerLinearProgrammingCrossCheck(instance);
+            break;
+        case 3:
+            {
+                int next_option = optionsMenu();
+                handleMenuOption(next_option, instance);
+            }
+            break;
+        }
+    }
+    break;
     case 6:
-        optionCompareAllAlgorithms(pallets, weights, profits, n, capacity);
+        optionCompareAllAlgorithms(instance);
         break;
     case 7:
+        optionIncrementalResolve(instance);
+        break;
+    case 8:
+        optionCapacitySweep(instance);
+        break;
+    case 9:
+        optionMultiTruckFleet(instance);
+        break;
+    case 10:
+    {
+        int subOption = twoDimensionalSubmenu();
+        switch (subOption)
+        {
+        case 1:
+            optionTwoDimensionalDP(instance);
+            break;
+        case 2:
+            optionTwoDimensionalBranchAndBound(instance);
+            break;
+        case 3:
+            {
+                int next_option = optionsMenu();
+                handleMenuOption(next_option, instance);
+            }
+            break;
+        }
+    }
+    break;
+    case 11:
+        optionAutomaticSolver(instance);
+        break;
+    case 12:
         cout << "\nReturning to the main menu...\n";
         mainMenu();
         break;
-    case 8:
+    case 13:
         cout << "Exiting..." << endl;
         exit(0);
     default:
         break;
     }
 
-    if (option >= 1 && option <= 6)
+    if (option >= 1 && option <= 11)
     {
         cout << "\nReturning to menu with the same data...\n";
         this_thread::sleep_for(chrono::seconds(1));
         int next_option = optionsMenu();
-        handleMenuOption(next_option, pallets, weights, profits, n, capacity);
+        handleMenuOption(next_option, instance);
     }
 }
 
-void datasetSelectionAndRun()
+int datasetSelectionMenu()
 {
     int datasetNumber;
     while (true)
@@ -183,37 +268,193 @@ void datasetSelectionAndRun()
             break;
         }
     }
-    // build file paths
+    return datasetNumber;
+}
+
+void datasetFilePaths(int datasetNumber, string &truckFile, string &palletFile)
+{
     string basePath = (datasetNumber >= 1 && datasetNumber <= 4) ? "datasets/" : "datasets-extra/";
     string formattedNumber = (datasetNumber < 10) ? ("0" + to_string(datasetNumber)) : to_string(datasetNumber);
-    string truckFile = "../" + basePath + "TruckAndPallets_" + formattedNumber + ".csv";
-    string palletFile = "../" + basePath + "Pallets_" + formattedNumber + ".csv";
+    truckFile = "../" + basePath + "TruckAndPallets_" + formattedNumber + ".csv";
+    palletFile = "../" + basePath + "Pallets_" + formattedNumber + ".csv";
+}
+
+void datasetSelectionAndRun()
+{
+    int datasetNumber = datasetSelectionMenu();
+    string truckFile, palletFile;
+    datasetFilePaths(datasetNumber, truckFile, palletFile);
     // read truck and pallet data
-    unsigned int trucksAndPallets[2];
-    readTrucks(truckFile, trucksAndPallets);
-    unsigned int capacity = trucksAndPallets[0];
-    unsigned int n = trucksAndPallets[1];
-    unsigned int *pallets = new unsigned int[n];
-    unsigned int *weights = new unsigned int[n];
-    unsigned int *profits = new unsigned int[n];
-    readPallets(palletFile, pallets, weights, profits);
+    Instance instance;
+    if (!readInstance(truckFile, palletFile, instance))
+    {
+        cerr << "Failed to load dataset " << datasetNumber << endl;
+        return;
+    }
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance.view();
 
     // show dataset info
     cout << endl
          << "Loaded dataset " << datasetNumber << ":\n";
     cout << "Truck capacity: " << capacity << endl;
+    if (volumes != nullptr)
+        cout << "Truck volume: " << volumeCapacity << endl;
+    if (maxPallets != 0)
+        cout << "Pallet limit: " << maxPallets << endl;
     cout << "Number of pallets: " << n << endl;
-    cout << setw(10) << "ID" << setw(10) << "Weight" << setw(10) << "Profit" << endl;
+    cout << setw(10) << "ID" << setw(10) << "Weight" << setw(10) << "Profit";
+    if (volumes != nullptr)
+        cout << setw(10) << "Volume";
+    cout << endl;
     for (unsigned int i = 0; i < n; i++)
     {
-        cout << setw(10) << pallets[i] << setw(10) << weights[i] << setw(10) << profits[i] << endl;
+        cout << setw(10) << pallets[i] << setw(10) << weights[i] << setw(10) << profits[i];
+        if (volumes != nullptr)
+            cout << setw(10) << volumes[i];
+        cout << endl;
     }
   
     int option = optionsMenu();
-    handleMenuOption(option, pallets, weights, profits, n, capacity);
-    delete[] pallets;
-    delete[] weights;
-    delete[] profits;
+    handleMenuOption(option, instance.view());
+}
+
+void binaryInstanceSelectionAndRun()
+{
+    cout << "\nEnter the path of the binary instance (.kbin): ";
+    string filename;
+    cin >> filename;
+
+    Stopwatch stopwatch;
+    BinaryInstance binary(filename);
+    double loadMs = stopwatch.elapsed().wall_ms;
+
+    if (!binary.isValid())
+    {
+        cerr << "Failed to load " << filename << ": " << binary.error() << endl;
+        return;
+    }
+    // the checksum is O(n): it is checked after conversion and by the verify option, not on every load
+
+    InstanceView instance = binary.view();
+    cout << endl
+         << "Loaded binary instance in " << loadMs << " ms\n";
+    cout << "Truck capacity: " << instance.capacity << endl;
+    if (instance.max_pallets != 0)
+        cout << "Pallet limit: " << instance.max_pallets << endl;
+    cout << "Number of pallets: " << instance.n << endl;
+
+    int option = optionsMenu();
+    handleMenuOption(option, instance);
+}
+
+void optionConvertDatasetToBinary()
+{
+    int datasetNumber = datasetSelectionMenu();
+    string truckFile, palletFile;
+    datasetFilePaths(datasetNumber, truckFile, palletFile);
+    string binaryFile = palletFile.substr(0, palletFile.size() - 4) + BINARY_INSTANCE_EXTENSION;
+
+    if (!convertCsvToBinary(truckFile, palletFile, binaryFile))
+    {
+        cerr << "Failed to convert dataset " << datasetNumber << endl;
+        return;
+    }
+
+    // read the file back once, so later loads can skip the checksum
+    BinaryInstance written(binaryFile);
+    if (!written.isValid() || !written.verifyChecksum())
+    {
+        cerr << "Dataset " << datasetNumber << " was written to " << binaryFile
+             << " but does not read back correctly" << endl;
+        return;
+    }
+    cout << "Dataset " << datasetNumber << " written to " << binaryFile << " (checksum verified)" << endl;
+}
+
+void optionVerifyBinaryInstance()
+{
+    cout << "\nEnter the path of the binary instance (.kbin): ";
+    string filename;
+    cin >> filename;
+
+    BinaryInstance binary(filename);
+    if (!binary.isValid())
+    {
+        cerr << "Failed to load " << filename << ": " << binary.error() << endl;
+        return;
+    }
+    Stopwatch stopwatch;
+    bool intact = binary.verifyChecksum();
+    double elapsedMs = stopwatch.elapsed().wall_ms;
+    if (intact)
+        cout << filename << ": checksum matches (" << binary.view().n << " pallets, " << elapsedMs << " ms)" << endl;
+    else
+        cerr << "Checksum mismatch in " << filename << ", the file is corrupted." << endl;
+}
+
+void optionStreamingMode()
+{
+    int inputCapacity;
+    cout << "\nEnter truck capacity (maximum weight): ";
+    while (!(cin >> inputCapacity) || inputCapacity <= 0)
+    {
+        cout << "Invalid input. Please enter a positive number: ";
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+
+    cout << "Enter the pallet source ('-' for stdin, or a file/FIFO path): ";
+    string source;
+    cin >> source;
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+
+    ifstream file;
+    if (source != "-")
+    {
+        // opening a FIFO blocks until a writer connects
+        file.open(source);
+        if (!file.is_open())
+        {
+            cerr << "Failed to open file: " << source << endl;
+            return;
+        }
+    }
+    istream &input = source == "-" ? cin : file;
+
+    OnlineKnapsack solver(static_cast<unsigned int>(inputCapacity));
+    cout << "\nReading pallets as 'palletID weight profit', one per line ('end' or end of file to finish):\n";
+
+    string line;
+    while (getline(input, line) && line != "end")
+    {
+        istringstream fields(line);
+        long long palletID, weight, profit;
+        if (!(fields >> palletID >> weight >> profit))
+        {
+            if (line.find_first_not_of(" \t\r") != string::npos)
+                cerr << "Invalid data in line: " << line << endl;
+            continue;
+        }
+        if (palletID < 0 || weight <= 0 || profit < 0 ||
+            palletID > numeric_limits<unsigned int>::max() ||
+            weight > numeric_limits<unsigned int>::max() ||
+            profit > numeric_limits<unsigned int>::max())
+        {
+            cerr << "Data out of range in line: " << line << endl;
+            continue;
+        }
+
+        solver.addPallet(static_cast<unsigned int>(palletID), static_cast<unsigned int>(weight),
+                         static_cast<unsigned int>(profit));
+        cout << "Pallet #" << solver.size() << " (ID " << palletID << "): best profit "
+             << solver.bestProfit() << " with " << solver.bestPalletCount() << " pallet(s)" << endl;
+    }
+
+    // stdin may have hit end of file; clear it so the menus keep working
+    if (source == "-")
+        cin.clear();
+
+    OutputOnlineKnapsack(solver, solver.solution());
 }
 
 void optionShowInfoMenu()
@@ -239,6 +480,9 @@ void optionShowInfoMenu()
         cout << "   - Datasets 5-10: Extra datasets with varied complexity\n";
         cout << "2. Review the loaded dataset information (truck capacity, number of pallets, weights, profits).\n";
         cout << "3. Select an algorithm to run on the selected dataset.\n";
+        cout << "   For the weight + volume (2D) solvers, add a Volume column to both CSVs:\n";
+        cout << "   Pallet,Weight,Profit,Volume and Capacity,Pallets,Volume.\n";
+        cout << "   A MaxPallets column in the truck CSV limits the number of pallets loaded.\n";
 
         cout << "\nReturning to main menu...\n";
         this_thread::sleep_for(chrono::seconds(3));
@@ -283,24 +527,23 @@ void optionShowInfoMenu()
     }
 }
 
-void optionExhaustiveSearch(unsigned int pallets[], unsigned int weights[],
-                            unsigned int profits[], unsigned int n,
-                            unsigned int capacity)
+void optionExhaustiveSearch(const InstanceView &instance)
 {
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
     std::cout << "\nRunning Exhaustive Search Algorithm...\n";
     std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
     std::cout << "Number of available pallets: " << n << "\n\n";
 
-    auto start = std::chrono::high_resolution_clock::now();
+    Stopwatch stopwatch;
 
-    BFSol solution = knapsackBF(profits, weights, n, capacity);
+    BFSol solution = knapsackBF(profits, weights, n, capacity, maxPallets);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    TimingSample timing = stopwatch.elapsed();
 
     if (solution.total_profit > 0 || solution.pallet_count > 0)
     {
-        OutputExhaustiveSolution(pallets, weights, profits, n, solution, duration.count() / 1000.0);
+        OutputExhaustiveSolution(pallets, weights, profits, n, solution, timing);
     }
     else
     {
@@ -310,19 +553,30 @@ void optionExhaustiveSearch(unsigned int pallets[], unsigned int weights[],
     }
 }
 
-void optionDynamicProgramming(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
-                              unsigned int capacity)
+void optionDynamicProgramming(const InstanceView &instance)
 {
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
     std::cout << "\nRunning Dynamic Programming Algorithm...\n";
     std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
     std::cout << "Number of available pallets: " << n << "\n\n";
 
-    auto start = std::chrono::high_resolution_clock::now();
+    if (maxPallets != 0 && !knapsackDPCardinalityFits(weights, n, capacity, maxPallets))
+    {
+        std::cout << "The pallets x limit x capacity table is too large for the DP on this instance; "
+                     "use the native Branch-and-Bound instead.\n";
+        return;
+    }
 
     bool *usedItems = new bool[n]();
 
-    unsigned int totalProfit = knapsackDP(profits, weights, n, capacity, usedItems);
+    Stopwatch stopwatch;
+
+    unsigned int totalProfit = maxPallets == 0
+                                   ? knapsackDP(profits, weights, n, capacity, usedItems)
+                                   : knapsackDPCardinality(profits, weights, n, capacity, maxPallets, usedItems);
+
+    TimingSample timing = stopwatch.elapsed();
 
     unsigned int totalWeight = 0;
     unsigned int palletCount = 0;
@@ -336,34 +590,30 @@ void optionDynamicProgramming(unsigned int pallets[], unsigned int weights[],
         }
     }
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-
     OutputDynamicProgramming(pallets, weights, profits, n,
                              totalProfit, totalWeight, palletCount,
-                             usedItems, duration.count() / 1000.0);
+                             usedItems, timing);
 
     delete[] usedItems;
 }
 
-void optionBacktracking(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        unsigned int capacity)
+void optionBacktracking(const InstanceView &instance)
 {
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
     std::cout << "\nRunning Backtracking Algorithm...\n";
     std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
     std::cout << "Number of available pallets: " << n << "\n\n";
 
-    auto start = std::chrono::high_resolution_clock::now();
+    Stopwatch stopwatch;
 
-    BTSol solution = knapsackBT(profits, weights, n, capacity);
+    BTSol solution = knapsackBT(profits, weights, n, capacity, maxPallets);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    TimingSample timing = stopwatch.elapsed();
 
     if (solution.total_profit > 0 || solution.pallet_count > 0)
     {
-        OutputBacktracking(pallets, weights, profits, n, solution, duration.count() / 1000.0);
+        OutputBacktracking(pallets, weights, profits, n, solution, timing);
     }
     else
     {
@@ -373,20 +623,18 @@ void optionBacktracking(unsigned int pallets[], unsigned int weights[],
     }
 }
 
-void optionGreedyRatio(unsigned int pallets[], unsigned int weights[],
-                       unsigned int profits[], unsigned int n,
-                       unsigned int capacity)
+void optionGreedyRatio(const InstanceView &instance)
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    Stopwatch stopwatch;
 
-    GreedySol solution = knapsackGreedyRatio(profits, weights, n, capacity);
+    GreedySol solution = knapsackGreedyRatio(profits, weights, n, capacity, maxPallets);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    TimingSample timing = stopwatch.elapsed();
 
     if (solution.total_profit > 0 || solution.pallet_count > 0)
     {
-        OutputGreedyApproximation(pallets, weights, profits, n, solution, duration.count() / 1000.0);
+        OutputGreedyApproximation(pallets, weights, profits, n, solution, timing);
     }
     else
     {
@@ -396,20 +644,18 @@ void optionGreedyRatio(unsigned int pallets[], unsigned int weights[],
     }
 }
 
-void optionGreedyProfit(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        unsigned int capacity)
+void optionGreedyProfit(const InstanceView &instance)
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    Stopwatch stopwatch;
 
-    GreedySol solution = knapsackGreedyProfit(profits, weights, n, capacity);
+    GreedySol solution = knapsackGreedyProfit(profits, weights, n, capacity, maxPallets);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    TimingSample timing = stopwatch.elapsed();
 
     if (solution.total_profit > 0 || solution.pallet_count > 0)
     {
-        OutputGreedyApproximation(pallets, weights, profits, n, solution, duration.count() / 1000.0);
+        OutputGreedyApproximation(pallets, weights, profits, n, solution, timing);
     }
     else
     {
@@ -419,24 +665,23 @@ void optionGreedyProfit(unsigned int pallets[], unsigned int weights[],
     }
 }
 
-void optionGreedyMaximum(unsigned int pallets[], unsigned int weights[],
-                         unsigned int profits[], unsigned int n,
-                         unsigned int capacity)
+void optionGreedyMaximum(const InstanceView &instance)
 {
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
     std::cout << "\nRunning Greedy Algorithm (Maximum of Both Approaches)...\n";
     std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
     std::cout << "Number of available pallets: " << n << "\n\n";
 
-    auto start = std::chrono::high_resolution_clock::now();
+    Stopwatch stopwatch;
 
-    GreedySol solution = knapsackGreedyMaximum(profits, weights, n, capacity);
+    GreedySol solution = knapsackGreedyMaximum(profits, weights, n, capacity, maxPallets);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    TimingSample timing = stopwatch.elapsed();
 
     if (solution.total_profit > 0 || solution.pallet_count > 0)
     {
-        OutputGreedyApproximation(pallets, weights, profits, n, solution, duration.count() / 1000.0);
+        OutputGreedyApproximation(pallets, weights, profits, n, solution, timing);
     }
     else
     {
@@ -446,31 +691,105 @@ void optionGreedyMaximum(unsigned int pallets[], unsigned int weights[],
     }
 }
 
-void optionIntegerLinearProgramming(unsigned int pallets[], unsigned int weights[],
-                                    unsigned int profits[], unsigned int n,
-                                    unsigned int capacity)
+void optionGreedyLocalSearch(const InstanceView &instance)
 {
-    std::cout << "\nRunning Integer Linear Programming (PuLP)...\n";
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    std::cout << "\nRunning Greedy Algorithm (Maximum of Both) + Local Search...\n";
     std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
     std::cout << "Number of available pallets: " << n << "\n\n";
 
-    std::ofstream inputFile("input.txt");
-    inputFile << n << "\n";
-    inputFile << capacity << "\n";
-    for (unsigned int i = 0; i < n; i++)
-        inputFile << weights[i] << " ";
-    inputFile << "\n";
-    for (unsigned int i = 0; i < n; i++)
-        inputFile << profits[i] << " ";
-    inputFile.close();
+    Stopwatch stopwatch;
+
+    GreedySol solution = knapsackGreedyMaximum(profits, weights, n, capacity, maxPallets);
+    LocalSearchStats stats = improveGreedySolution(profits, weights, n, capacity, solution, LOCAL_SEARCH_DEFAULT_BUDGET_MS, maxPallets);
 
-    auto start = std::chrono::high_resolution_clock::now();
+    TimingSample timing = stopwatch.elapsed();
 
-    // try running with python3
-    // first try with the script in the current directory, then try with the script in the Approaches directory
-    int ret = system("python3 knapsack_solver.py input.txt output.txt || "
-                    "python3 ../Approaches/knapsack_solver.py input.txt output.txt");
-    if (ret != 0)
+    if (solution.total_profit > 0 || solution.pallet_count > 0)
+    {
+        OutputGreedyLocalSearch(pallets, weights, profits, n, solution, stats, timing);
+    }
+    else
+    {
+        std::cout << "\nPress Enter to return to the algorithms menu...";
+        std::cin.ignore();
+        std::cin.get();
+    }
+}
+
+void optionSimulatedAnnealing(const InstanceView &instance)
+{
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    std::cout << "\nRunning Parallel Simulated Annealing...\n";
+    std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, false);
+    std::cout << "Number of available pallets: " << n << "\n";
+    std::cout << "Time budget: " << METAHEURISTIC_DEFAULT_BUDGET_MS << " ms\n\n";
+
+    Stopwatch stopwatch;
+
+    MetaheuristicSol solution = knapsackSimulatedAnnealing(profits, weights, n, capacity);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    if (solution.total_profit > 0 || solution.pallet_count > 0)
+    {
+        OutputMetaheuristic(pallets, weights, profits, n, solution, timing);
+    }
+    else
+    {
+        std::cout << "\nPress Enter to return to the algorithms menu...";
+        std::cin.ignore();
+        std::cin.get();
+    }
+}
+
+void optionIntegerLinearProgramming(const InstanceView &instance)
+{
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    std::cout << "\nRunning Integer Linear Programming (native branch-and-bound)...\n";
+    std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, true);
+    std::cout << "Number of available pallets: " << n << "\n\n";
+
+    Stopwatch stopwatch;
+
+    ILPSol solution = knapsackBranchAndBound(profits, weights, n, capacity, maxPallets);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    if (solution.total_profit > 0 || solution.pallet_count > 0)
+    {
+        OutputIntegerLinearProgramming(pallets, weights, profits, n, capacity,
+                                       solution, timing);
+    }
+    else
+    {
+        std::cout << "\nPress Enter to return to the algorithms menu...";
+        std::cin.ignore();
+        std::cin.get();
+    }
+}
+
+void optionIntegerLinearProgrammingCrossCheck(const InstanceView &instance)
+{
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    std::cout << "\nRunning Integer Linear Programming (PuLP cross-check)...\n";
+    std::cout << "Truck capacity: " << capacity << "\n";
+    showPalletLimit(maxPallets, false);
+    std::cout << "Number of available pallets: " << n << "\n\n";
+
+    ILPSol nativeSolution = knapsackBranchAndBound(profits, weights, n, capacity);
+
+    Stopwatch stopwatch;
+
+    ILPSol pythonSolution;
+    bool ok = knapsackILPPython(profits, weights, n, capacity, pythonSolution);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    if (!ok)
     {
         std::cerr << "Failed to run ILP solver.\n";
         std::cerr << "Make sure you have Python 3 and PuLP installed globally.\n";
@@ -483,61 +802,327 @@ void optionIntegerLinearProgramming(unsigned int pallets[], unsigned int weights
         std::cin.get();
         return;
     }
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-    std::ifstream outputFile("output.txt");
-    int totalProfit = 0, totalWeight = 0;
-    std::vector<int> selectedIndices;
-    std::string line;
+    std::cout << "Native branch-and-bound profit: " << nativeSolution.total_profit << "\n";
+    std::cout << "PuLP profit: " << pythonSolution.total_profit << "\n";
+    if (nativeSolution.total_profit == pythonSolution.total_profit)
+    {
+        std::cout << "Cross-check passed: both solvers agree on the optimal profit.\n";
+    }
+    else
+    {
+        std::cout << "Cross-check FAILED: the solvers disagree on the optimal profit!\n";
+    }
+
+    OutputIntegerLinearProgramming(pallets, weights, profits, n, capacity,
+                                   pythonSolution, timing);
+}
+
+void optionIncrementalResolve(const InstanceView &instance)
+{
+    showPalletLimit(instance.max_pallets, false);
+    std::cout << "\nBuilding incremental DP tables...\n";
+    Stopwatch stopwatch;
+    // spare capacity in the rows lets "capacity" raises skip the rebuild
+    IncrementalKnapsack solver(instance, instance.capacity * INCREMENTAL_CAPACITY_HEADROOM);
+    TimingSample timing = stopwatch.elapsed();
+    std::cout << "Initial optimum: " << solver.bestProfit() << " (built in " << timing.wall_ms << " ms, user "
+              << timing.user_ms << " ms, sys " << timing.sys_ms << " ms)\n\n";
+
+    std::cout << "Commands: add <palletID> <weight> <profit> | remove <palletID> | capacity <value> | show | done\n";
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-    if (outputFile.is_open())
+    std::string line;
+    while (std::cout << "> " && std::getline(std::cin, line))
     {
-        if (std::getline(outputFile, line))
+        std::istringstream fields(line);
+        std::string command;
+        if (!(fields >> command))
+            continue;
+        if (command == "done")
+            break;
+
+        stopwatch.restart();
+        bool edited = true;
+        if (command == "add")
         {
-            totalProfit = std::stoi(line);
+            unsigned int palletID, weight, profit;
+            if (fields >> palletID >> weight >> profit && weight > 0)
+                solver.addPallet(palletID, weight, profit);
+            else
+            {
+                std::cout << "Usage: add <palletID> <weight> <profit> (weight must be positive)\n";
+                edited = false;
+            }
         }
-
-        if (std::getline(outputFile, line))
+        else if (command == "remove")
         {
-            totalWeight = std::stoi(line);
+            unsigned int palletID;
+            if (!(fields >> palletID))
+            {
+                std::cout << "Usage: remove <palletID>\n";
+                edited = false;
+            }
+            else if (!solver.removePallet(palletID))
+            {
+                std::cout << "Pallet " << palletID << " is not in the manifest.\n";
+                edited = false;
+            }
         }
-
-        if (std::getline(outputFile, line))
+        else if (command == "capacity")
         {
-            std::istringstream iss(line);
-            int index;
-            while (iss >> index)
+            unsigned int newCapacity;
+            if (fields >> newCapacity)
+                solver.changeCapacity(newCapacity);
+            else
             {
-                // add the index (it's 0-based in the output file)
-                selectedIndices.push_back(index);
+                std::cout << "Usage: capacity <value>\n";
+                edited = false;
             }
         }
-        outputFile.close();
+        else if (command == "show")
+        {
+            OutputIncrementalKnapsack(solver.manifest(), solver.solution());
+            continue;
+        }
+        else
+        {
+            std::cout << "Unknown command: " << command << "\n";
+            continue;
+        }
+
+        if (edited)
+        {
+            unsigned int profit = solver.bestProfit();
+            timing = stopwatch.elapsed();
+            std::cout << "Optimum: " << profit << " (" << solver.size() << " pallets, capacity "
+                      << solver.truckCapacity() << ", updated in " << timing.wall_ms << " ms, user "
+                      << timing.user_ms << " ms, sys " << timing.sys_ms << " ms)\n";
+        }
     }
-    else
+
+    OutputIncrementalKnapsack(solver.manifest(), solver.solution());
+}
+
+void optionCapacitySweep(const InstanceView &instance)
+{
+    showPalletLimit(instance.max_pallets, false);
+    std::cout << "\nEnter the truck capacities to evaluate, separated by spaces: ";
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    std::string line;
+    std::getline(std::cin, line);
+
+    std::vector<unsigned int> capacities;
+    std::istringstream fields(line);
+    std::string token;
+    while (fields >> token)
+    {
+        std::istringstream number(token);
+        long long value;
+        if (number >> value && number.eof() && value >= 0 && value <= std::numeric_limits<unsigned int>::max())
+            capacities.push_back(static_cast<unsigned int>(value));
+        else
+            std::cout << "Ignoring invalid capacity: " << token << "\n";
+    }
+    if (std::find(capacities.begin(), capacities.end(), instance.capacity) == capacities.end())
+        capacities.push_back(instance.capacity);
+    std::sort(capacities.begin(), capacities.end());
+
+    std::cout << "\nRunning one DP pass for the largest capacity (" << capacities.back() << ")...\n";
+
+    Stopwatch stopwatch;
+    CapacitySweep sweep(instance, capacities.back());
+    TimingSample timing = stopwatch.elapsed();
+
+    OutputCapacitySweep(capacities, sweep, timing);
+
+    unsigned int capacity;
+    std::cout << "\nEnter a capacity to list its pallets (0 to continue): ";
+    while (std::cin >> capacity && capacity != 0)
+    {
+        OutputCapacitySelection(instance, capacity, sweep.solutionAt(capacity));
+        std::cout << "\nEnter a capacity to list its pallets (0 to continue): ";
+    }
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::cout << "Export the profit-vs-capacity curve to CSV? Enter a file name (empty to skip): ";
+    std::getline(std::cin, line);
+    if (!line.empty() && sweep.exportCurveCsv(line))
+        std::cout << "Curve for capacities 0-" << sweep.maxCapacity() << " written to " << line << "\n";
+}
+
+void optionMultiTruckFleet(const InstanceView &instance)
+{
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+
+    std::cout << "\nEnter a fleet CSV (one 'Capacity,Pallets' row per truck) or '-' to type the capacities: ";
+    std::string source;
+    std::cin >> source;
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::vector<unsigned int> capacities;
+    if (source == "-")
+    {
+        std::cout << "Enter the truck capacities, separated by spaces: ";
+        std::string line;
+        std::getline(std::cin, line);
+        std::istringstream fields(line);
+        long long value;
+        while (fields >> value)
+        {
+            if (value >= 0 && value <= std::numeric_limits<unsigned int>::max())
+                capacities.push_back(static_cast<unsigned int>(value));
+        }
+    }
+    else if (!readFleet(source, capacities))
     {
-        std::cerr << "Unable to open output.txt file\n";
         return;
     }
 
-    if (totalProfit > 0 || !selectedIndices.empty())
+    if (capacities.empty())
     {
-        OutputIntegerLinearProgramming(pallets, weights, profits, n, capacity,
-                                       totalProfit, totalWeight, selectedIndices,
-                                       duration.count() / 1000.0);
+        std::cout << "No trucks given, using the loaded truck (capacity " << capacity << ").\n";
+        capacities.push_back(capacity);
     }
-    else
+
+    std::cout << "\nRunning Multi-Truck Fleet Solver...\n";
+    std::cout << "Trucks: " << capacities.size() << "\n";
+    showPalletLimit(maxPallets, false);
+    std::cout << "Number of available pallets: " << n << "\n\n";
+
+    Stopwatch stopwatch;
+
+    FleetSol solution = knapsackMultipleTrucks(profits, weights, n, capacities);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    OutputMultiTruckFleet(pallets, weights, profits, n, solution, timing);
+}
+
+int twoDimensionalSubmenu()
+{
+    cout << endl
+         << "=============================================\n";
+    cout << "     WEIGHT + VOLUME (2D) LOADING OPTIONS    \n";
+    cout << "=============================================\n\n";
+
+    int choice;
+    do
     {
-        std::cout << "\nPress Enter to return to the algorithms menu...";
-        std::cin.ignore();
-        std::cin.get();
+        cout << "1: 2D Dynamic Programming (small capacities)" << endl;
+        cout << "2: 2D Branch-and-Bound (surrogate bound)" << endl;
+        cout << "3: Back to Main Menu" << endl;
+        cout << "Option: ";
+        cin >> choice;
+        cout << endl;
+
+        if (choice < 1 || choice > 3)
+            cout << "Invalid input. Please choose 1-3." << endl;
+    } while (choice < 1 || choice > 3);
+
+    return choice;
+}
+
+void optionTwoDimensionalDP(const InstanceView &instance)
+{
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    if (volumes == nullptr)
+    {
+        std::cout << "This instance has no volume column; add a Volume column to the pallet CSV "
+                     "and to the truck CSV to use the 2D solvers.\n";
+        return;
+    }
+    if (!twoDimDPFits(weights, volumes, n, capacity, volumeCapacity))
+    {
+        std::cout << "The weight x volume table is too large for the 2D DP on this instance; "
+                     "use the 2D Branch-and-Bound instead.\n";
+        return;
     }
+
+    std::cout << "\nRunning 2D Dynamic Programming Algorithm...\n";
+    std::cout << "Truck capacity: " << capacity << ", truck volume: " << volumeCapacity << "\n";
+    showPalletLimit(maxPallets, false);
+    std::cout << "Number of available pallets: " << n << "\n\n";
+
+    Stopwatch stopwatch;
+
+    TwoDimSol solution = knapsack2DDP(profits, weights, volumes, n, capacity, volumeCapacity);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    OutputTwoDimensional(instance, solution, timing);
 }
 
-unsigned int *interactiveDataEntry()
+void optionTwoDimensionalBranchAndBound(const InstanceView &instance)
 {
-    int inputCapacity, inputNumPallets;         
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    if (volumes == nullptr)
+    {
+        std::cout << "This instance has no volume column; add a Volume column to the pallet CSV "
+                     "and to the truck CSV to use the 2D solvers.\n";
+        return;
+    }
+
+    std::cout << "\nRunning 2D Branch-and-Bound Algorithm...\n";
+    std::cout << "Truck capacity: " << capacity << ", truck volume: " << volumeCapacity << "\n";
+    showPalletLimit(maxPallets, false);
+    std::cout << "Number of available pallets: " << n << "\n\n";
+
+    Stopwatch stopwatch;
+
+    TwoDimSol solution = knapsack2DBranchAndBound(profits, weights, volumes, n, capacity, volumeCapacity);
+
+    TimingSample timing = stopwatch.elapsed();
+
+    OutputTwoDimensional(instance, solution, timing);
+}
+
+void optionAutomaticSolver(const InstanceView &instance)
+{
+    SolverOptions options;
+    SolverChoice choice = chooseSolver(instance, options.time_budget_ms, activeCostModel());
+
+    std::cout << "\nChoosing a solver with the cost model...\n";
+    std::cout << "Predicted times:";
+    std::streamsize precision = std::cout.precision(3);
+    for (const auto &[name, ms] : choice.estimates)
+        std::cout << "  " << name << " " << ms << " ms";
+    std::cout.precision(precision);
+    std::cout << "\nChosen: " << choice.solver << " (" << choice.reason << ")\n\n";
+
+    // runs the chosen solver through the registry, which also notes ignored constraints
+    SolverResult result = runSolver(*findSolver(choice.solver), instance, options);
+    OutputSolverResultText(std::cout, instance, result);
+}
+
+int integerProgrammingSubmenu()
+{
+    cout << endl
+         << "=============================================\n";
+    cout << "      INTEGER LINEAR PROGRAMMING OPTIONS     \n";
+    cout << "=============================================\n\n";
+
+    int choice;
+    do
+    {
+        cout << "1: Native Branch-and-Bound (in-process)" << endl;
+        cout << "2: PuLP Cross-Check (Python)" << endl;
+        cout << "3: Back to Main Menu" << endl;
+        cout << "Option: ";
+        cin >> choice;
+        cout << endl;
+
+        if (choice < 1 || choice > 3)
+            cout << "Invalid input. Please choose 1-3." << endl;
+    } while (choice < 1 || choice > 3);
+
+    return choice;
+}
+
+Instance interactiveDataEntry()
+{
+    int inputCapacity, inputNumPallets, inputMaxPallets;
     int inputPalletID, inputWeight, inputProfit; 
     unsigned int capacity, numPallets;
 
@@ -565,13 +1150,19 @@ unsigned int *interactiveDataEntry()
     numPallets = static_cast<unsigned int>(inputNumPallets); 
     cin.ignore(numeric_limits<streamsize>::max(), '\n');    
 
-    unsigned int *result = new unsigned int[2 + 3 * numPallets];
-    result[0] = capacity;
-    result[1] = numPallets;
+    cout << "Enter the maximum number of pallets allowed (0 for no limit): ";
+    while (!(cin >> inputMaxPallets) || inputMaxPallets < 0)
+    {
+        cout << "Invalid input. Please enter a non-negative number: ";
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
-    unsigned int *pallets = &result[2];
-    unsigned int *weights = &result[2 + numPallets];
-    unsigned int *profits = &result[2 + 2 * numPallets];
+    Instance result;
+    result.capacity = capacity;
+    result.max_pallets = static_cast<unsigned int>(inputMaxPallets);
+    result.reserve(numPallets);
 
     cout << "\nEnter pallet data in the format 'palletID weight profit':\n";
 
@@ -598,9 +1189,9 @@ unsigned int *interactiveDataEntry()
                 }
                 else
                 {
-                    pallets[i] = static_cast<unsigned int>(inputPalletID);
-                    weights[i] = static_cast<unsigned int>(inputWeight);
-                    profits[i] = static_cast<unsigned int>(inputProfit);
+                    result.push_back(static_cast<unsigned int>(inputPalletID),
+                                     static_cast<unsigned int>(inputWeight),
+                                     static_cast<unsigned int>(inputProfit));
                     validInput = true;
                 }
             }
@@ -618,6 +1209,8 @@ unsigned int *interactiveDataEntry()
     cout << "Summary:\n";
     cout << "- Truck capacity: " << capacity << "\n";
     cout << "- Number of pallets: " << numPallets << "\n";
+    if (result.max_pallets != 0)
+        cout << "- Maximum pallets allowed: " << result.max_pallets << "\n";
 
     cout << "Pallet Data:\n";
     cout << setw(10) << "ID" << setw(10) << "Weight" << setw(10) << "Profit" << "\n";
@@ -625,7 +1218,7 @@ unsigned int *interactiveDataEntry()
 
     for (unsigned int i = 0; i < numPallets; i++)
     {
-        cout << setw(10) << pallets[i] << setw(10) << weights[i] << setw(10) << profits[i] << "\n";
+        cout << setw(10) << result.pallets[i] << setw(10) << result.weights[i] << setw(10) << result.profits[i] << "\n";
     }
     cout << "--------------------------------\n";
 
@@ -645,39 +1238,47 @@ int approximationSubmenu()
         cout << "1: Greedy A (Weight-to-Profit Ratio)" << endl;
         cout << "2: Greedy B (Biggest Profit Values)" << endl;
         cout << "3: Maximum of Both Approaches" << endl;
-        cout << "4: Back to Main Menu" << endl;
+        cout << "4: Maximum of Both + Local Search Improvement" << endl;
+        cout << "5: Parallel Simulated Annealing (Metaheuristic)" << endl;
+        cout << "6: Back to Main Menu" << endl;
         cout << "Option: ";
         cin >> choice;
         cout << endl;
 
-        if (choice < 1 || choice > 4)
-            cout << "Invalid input. Please choose 1-4." << endl;
-    } while (choice < 1 || choice > 4);
+        if (choice < 1 || choice > 6)
+            cout << "Invalid input. Please choose 1-6." << endl;
+    } while (choice < 1 || choice > 6);
 
     return choice;
 }
 
-void optionCompareAllAlgorithms(unsigned int pallets[], unsigned int weights[],
-                               unsigned int profits[], unsigned int n,
-                               unsigned int capacity)
+void optionCompareAllAlgorithms(const InstanceView &instance)
 {
+    auto [pallets, weights, profits, n, capacity, volumes, volumeCapacity, maxPallets] = instance;
+    showPalletLimit(maxPallets, true);
+    // the cardinality DP table can be too large; the native B&B solves that row instead
+    bool dpFallback = maxPallets != 0 && !knapsackDPCardinalityFits(weights, n, capacity, maxPallets);
     std::vector<std::string> algoNames;
     algoNames.push_back("Exhaustive Search");
-    algoNames.push_back("Dynamic Programming");
+    algoNames.push_back(dpFallback ? "DP (B&B fallback)" : "Dynamic Programming");
     algoNames.push_back("Backtracking");
     algoNames.push_back("Greedy Ratio");
     algoNames.push_back("Greedy Profit");
     algoNames.push_back("Greedy Maximum");
+    algoNames.push_back("Greedy + Local");
+    algoNames.push_back("Simulated Annealing");
     algoNames.push_back("Integer LP");
 
     std::vector<std::string> spaceComplexities;
     spaceComplexities.push_back("O(2^n)");      // Exhaustive Search
-    spaceComplexities.push_back("O(nW)");       // Dynamic Programming
+    spaceComplexities.push_back(dpFallback ? "O(n)" : "O(nW)");  // Dynamic Programming
     spaceComplexities.push_back("O(2^n)");      // Backtracking
     spaceComplexities.push_back("O(n log n)");  // Greedy Ratio
     spaceComplexities.push_back("O(n log n)");  // Greedy Profit
     spaceComplexities.push_back("O(n log n)");  // Greedy Maximum
-    spaceComplexities.push_back("Depends");     // Integer LP
+    spaceComplexities.push_back("O(n)");        // Greedy + Local Search
+    spaceComplexities.push_back("O(n × chains)");   // Simulated Annealing
+    spaceComplexities.push_back("O(n)");        // Integer LP (branch-and-bound)
 
 
     std::vector<std::string> accuracyAlgorithms;
@@ -687,36 +1288,45 @@ void optionCompareAllAlgorithms(unsigned int pallets[], unsigned int weights[],
     accuracyAlgorithms.push_back("Not Optimal");  // Greedy Ratio
     accuracyAlgorithms.push_back("Not Optimal");  // Greedy Profit
     accuracyAlgorithms.push_back("Not Optimal");  // Greedy Maximum
+    accuracyAlgorithms.push_back("Not Optimal");  // Greedy + Local Search
+    accuracyAlgorithms.push_back("Not Optimal");  // Simulated Annealing
     accuracyAlgorithms.push_back("Optimal");      // Integer LP
 
-    std::vector<double> runningTimes;
+    // a loading that breaks the pallet limit must not set the reference profit
+    std::vector<bool> respectsLimit(algoNames.size(), true);
+    respectsLimit[7] = maxPallets == 0;  // Simulated Annealing
+
+    std::vector<TimingSample> runningTimes;
     std::vector<unsigned int> finalProfits;  // vector to store profit values
 
+    // only the solver calls are timed: allocation, stream redirection and output stay outside
+
     // 1. Exhaustive Search
-    auto start = std::chrono::high_resolution_clock::now();
-    BFSol bfSol = knapsackBF(profits, weights, n, capacity);
-    auto end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    BFSol bfSol;
+    runningTimes.push_back(timeCall([&] { bfSol = knapsackBF(profits, weights, n, capacity, maxPallets); }));
     finalProfits.push_back(bfSol.total_profit); 
 
     // 2. Dynamic Programming
-    start = std::chrono::high_resolution_clock::now();
     bool *usedItems = new bool[n]();
-    unsigned int dpProfit = knapsackDP(profits, weights, n, capacity, usedItems);
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    unsigned int dpProfit = 0;
+    runningTimes.push_back(timeCall([&]
+    {
+        if (maxPallets == 0)
+            dpProfit = knapsackDP(profits, weights, n, capacity, usedItems);
+        else if (dpFallback)
+            dpProfit = knapsackBranchAndBound(profits, weights, n, capacity, maxPallets).total_profit;
+        else
+            dpProfit = knapsackDPCardinality(profits, weights, n, capacity, maxPallets, usedItems);
+    }));
     finalProfits.push_back(dpProfit);
     delete[] usedItems;
 
     // 3. Backtracking
-    start = std::chrono::high_resolution_clock::now();
-    BTSol btSol = knapsackBT(profits, weights, n, capacity);
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    BTSol btSol;
+    runningTimes.push_back(timeCall([&] { btSol = knapsackBT(profits, weights, n, capacity, maxPallets); }));
     finalProfits.push_back(btSol.total_profit);
 
     // 4. Greedy Ratio
-    start = std::chrono::high_resolution_clock::now();
     GreedySol grSol;
     {
         // redirect stdout and stderr to /dev/null
@@ -724,65 +1334,53 @@ void optionCompareAllAlgorithms(unsigned int pallets[], unsigned int weights[],
         std::streambuf *originalCoutBuffer = std::cout.rdbuf(nullStream.rdbuf());
         std::streambuf *originalCerrBuffer = std::cerr.rdbuf(nullStream.rdbuf());
 
-        grSol = knapsackGreedyRatio(profits, weights, n, capacity);
+        runningTimes.push_back(timeCall([&] { grSol = knapsackGreedyRatio(profits, weights, n, capacity, maxPallets); }));
 
         // restore stdout and stderr
         std::cout.rdbuf(originalCoutBuffer);
         std::cerr.rdbuf(originalCerrBuffer);
     }
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
     finalProfits.push_back(grSol.total_profit);  
 
     // 5. Greedy Profit
-    start = std::chrono::high_resolution_clock::now();
     GreedySol gpSol;
     {
         std::ofstream nullStream("/dev/null");
         std::streambuf *originalCoutBuffer = std::cout.rdbuf(nullStream.rdbuf());
         std::streambuf *originalCerrBuffer = std::cerr.rdbuf(nullStream.rdbuf());
 
-        gpSol = knapsackGreedyProfit(profits, weights, n, capacity);
+        runningTimes.push_back(timeCall([&] { gpSol = knapsackGreedyProfit(profits, weights, n, capacity, maxPallets); }));
 
         std::cout.rdbuf(originalCoutBuffer);
         std::cerr.rdbuf(originalCerrBuffer);
     }
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
     finalProfits.push_back(gpSol.total_profit); 
 
     // 6. Greedy Maximum
-    start = std::chrono::high_resolution_clock::now();
-    GreedySol gmSol = knapsackGreedyMaximum(profits, weights, n, capacity);
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    GreedySol gmSol;
+    runningTimes.push_back(timeCall([&] { gmSol = knapsackGreedyMaximum(profits, weights, n, capacity, maxPallets); }));
     finalProfits.push_back(gmSol.total_profit); 
 
-    // 7. Integer Linear Programming (with python script)
-    start = std::chrono::high_resolution_clock::now();
-    std::ofstream inputFile("input.txt");
-    inputFile << n << "\n";
-    inputFile << capacity << "\n";
-    for (unsigned int i = 0; i < n; i++) inputFile << weights[i] << " ";
-    inputFile << "\n";
-    for (unsigned int i = 0; i < n; i++) inputFile << profits[i] << " ";
-    inputFile.close();
-    int ret = system("python ../Approaches/knapsack_solver.py input.txt output.txt > /dev/null 2>&1");
-    
-    unsigned int ilpProfit = 0;
-    std::ifstream outputFile("output.txt");
-    if (outputFile.is_open()) {
-        std::string line;
-        if (std::getline(outputFile, line)) {
-            ilpProfit = std::stoi(line);
-        }
-        outputFile.close();
-    }
-    
-    end = std::chrono::high_resolution_clock::now();
-    runningTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
-    finalProfits.push_back(ilpProfit); 
-
-    OutputCompareAllAlgorithms(algoNames, runningTimes, spaceComplexities, accuracyAlgorithms, finalProfits);
+    // 7. Greedy Maximum + Local Search
+    GreedySol glSol;
+    runningTimes.push_back(timeCall([&]
+    {
+        glSol = knapsackGreedyMaximum(profits, weights, n, capacity, maxPallets);
+        improveGreedySolution(profits, weights, n, capacity, glSol, LOCAL_SEARCH_DEFAULT_BUDGET_MS, maxPallets);
+    }));
+    finalProfits.push_back(glSol.total_profit);
+
+    // 8. Simulated Annealing (shorter budget, the table runs every algorithm)
+    MetaheuristicSol saSol;
+    runningTimes.push_back(timeCall([&] { saSol = knapsackSimulatedAnnealing(profits, weights, n, capacity, 500.0); }));
+    finalProfits.push_back(saSol.total_profit);
+
+    // 9. Integer Linear Programming (native branch-and-bound)
+    ILPSol ilpSol;
+    runningTimes.push_back(timeCall([&] { ilpSol = knapsackBranchAndBound(profits, weights, n, capacity, maxPallets); }));
+    finalProfits.push_back(ilpSol.total_profit);
+
+    OutputCompareAllAlgorithms(algoNames, runningTimes, spaceComplexities, accuracyAlgorithms, finalProfits,
+                               respectsLimit);
 }
 
@@ -14,7 +14,17 @@
 #include "../Approaches/DynamicProgramming.h"
 #include "../Approaches/Backtracking.h"
 #include "../Approaches/Greedy.h"
+#include "../Approaches/LocalSearch.h"
+#include "../Approaches/Metaheuristic.h"
+#include "../Approaches/IntegerProgramming.h"
+#include "../Approaches/OnlineKnapsack.h"
+#include "../Approaches/IncrementalKnapsack.h"
+#include "../Approaches/CapacitySweep.h"
+#include "../Approaches/MultipleKnapsack.h"
+#include "../Approaches/SolverSelection.h"
 #include "../Output/Output.h"
+#include "../ReadData/Instance.h"
+#include "../ReadData/BinaryInstance.h"
 
 /**
  * @brief Entry point of the menu system
@@ -24,11 +34,28 @@
  * Main Menu options:
  * 1. Enter pallet data interactively
  * 2. Use predefined dataset
- * 3: Info & Instructions
- * 4. Exit
+ * 3. Load binary instance (.kbin)
+ * 4. Convert predefined dataset to binary
+ * 5. Stream pallets (stdin or FIFO)
+ * 6: Info & Instructions
+ * 7. Exit
  */
 void mainMenu();
 
+/**
+ * @brief Asks the user for a predefined dataset number
+ * @return Dataset number (1-10)
+ */
+int datasetSelectionMenu();
+
+/**
+ * @brief Builds the CSV paths of a predefined dataset
+ * @param datasetNumber Dataset number (1-10)
+ * @param truckFile Receives the TruckAndPallets CSV path
+ * @param palletFile Receives the Pallets CSV path
+ */
+void datasetFilePaths(int datasetNumber, std::string &truckFile, std::string &palletFile);
+
 /**
  * @brief Handles dataset selection and algorithm execution
  *
@@ -36,9 +63,41 @@ void mainMenu();
  */
 void datasetSelectionAndRun();
 
+/**
+ * @brief Loads a .kbin instance chosen by the user and runs the selected algorithm on it
+ *
+ * The file is memory-mapped and the solvers read its columns in place; the checksum is not
+ * verified here (see optionVerifyBinaryInstance)
+ */
+void binaryInstanceSelectionAndRun();
+
+/**
+ * @brief Converts a predefined dataset to a .kbin file stored next to its CSVs
+ *
+ * The written file is read back and its checksum verified once
+ */
+void optionConvertDatasetToBinary();
+
+/**
+ * @brief Checks the column checksum of a .kbin file chosen by the user
+ *
+ * Loading a .kbin does not verify it, so that the load stays independent of n; this is the
+ * explicit O(n) check
+ */
+void optionVerifyBinaryInstance();
+
+/**
+ * @brief Solves the knapsack incrementally while pallets arrive from stdin or a FIFO
+ *
+ * Asks for the truck capacity and the source ("-" for stdin, otherwise a file or FIFO path),
+ * then reads one pallet per line in the format "palletID weight profit" and prints the
+ * current optimum after each arrival. The stream ends at end of file or at a line "end".
+ */
+void optionStreamingMode();
+
 /**
  * @brief Displays the algorithms menu and gets user selection
- * @return Selected menu option (1-8)
+ * @return Selected menu option (1-13)
  *
  * Algorithms Menu options:
  * 1. Exhaustive Search Algorithm
@@ -47,23 +106,22 @@ void datasetSelectionAndRun();
  * 4. Approximation Algorithm
  * 5. Linear Integer Programming
  * 6. Compare All Algorithms
- * 7. Change Input Data
- * 8. Exit
+ * 7. Incremental Re-solve (edit the manifest)
+ * 8. Capacity Sweep (several truck sizes)
+ * 9. Multi-Truck Fleet
+ * 10. Weight + Volume Constraints (2D)
+ * 11. Automatic Solver Choice (cost model)
+ * 12. Change Input Data
+ * 13. Exit
  */
 int optionsMenu();
 
 /**
  * @brief Handles the selected menu option
- * @param option The selected menu option (1-8)
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck's maximum weight capacity
+ * @param option The selected menu option (1-13)
+ * @param instance Pallets and truck capacity
  */
-void handleMenuOption(int option, unsigned int pallets[], unsigned int weights[],
-                      unsigned int profits[], unsigned int n,
-                      int capacity);
+void handleMenuOption(int option, const InstanceView &instance);
 
 
 /**
@@ -76,51 +134,75 @@ void optionShowInfoMenu();
 
 /**
  * @brief Handles the exhaustive search algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
  */
-void optionExhaustiveSearch(unsigned int pallets[], unsigned int weights[],
-                            unsigned int profits[], unsigned int n,
-                            unsigned int capacity);
+void optionExhaustiveSearch(const InstanceView &instance);
 
 /**
  * @brief Handles the dynamic programming algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
  */
-void optionDynamicProgramming(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
-                              unsigned int capacity);
+void optionDynamicProgramming(const InstanceView &instance);
 
 /**
  * @brief Handles the backtracking algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
+ */
+void optionBacktracking(const InstanceView &instance);
+
+/**
+ * @brief Handles the integer linear programming algorithm option (native branch-and-bound)
+ * @param instance Pallets and truck capacity
  */
-void optionBacktracking(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        unsigned int capacity);
+void optionIntegerLinearProgramming(const InstanceView &instance);
 
 /**
- * @brief Handles the integer linear programming algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @brief Runs the PuLP Python solver and checks its profit against the native branch-and-bound
+ * @param instance Pallets and truck capacity
  */
-void optionIntegerLinearProgramming(unsigned int pallets[], unsigned int weights[],
-                                    unsigned int profits[], unsigned int n,
-                                    unsigned int capacity);
+void optionIntegerLinearProgrammingCrossCheck(const InstanceView &instance);
+
+/**
+ * @brief Displays the integer linear programming submenu
+ * @return Selected submenu option
+ *
+ * Submenu options:
+ * 1. Native Branch-and-Bound (in-process)
+ * 2. PuLP Cross-Check (Python)
+ * 3. Return to Main Menu
+ */
+int integerProgrammingSubmenu();
+
+/**
+ * @brief Runs the 2D (weight + volume) dynamic programming solver
+ * @param instance Pallets with volumes, truck capacity and truck volume
+ *
+ * Refuses instances without a volume column, or whose compressed table exceeds the DP limits.
+ */
+void optionTwoDimensionalDP(const InstanceView &instance);
+
+/**
+ * @brief Runs the 2D (weight + volume) branch-and-bound solver
+ * @param instance Pallets with volumes, truck capacity and truck volume
+ */
+void optionTwoDimensionalBranchAndBound(const InstanceView &instance);
+
+/**
+ * @brief Lets the cost model pick the solver (see chooseSolver), shows why and runs it
+ * @param instance Pallets and truck capacity
+ */
+void optionAutomaticSolver(const InstanceView &instance);
+
+/**
+ * @brief Displays the weight + volume (2D) submenu
+ * @return Selected submenu option
+ *
+ * Submenu options:
+ * 1. 2D Dynamic Programming
+ * 2. 2D Branch-and-Bound
+ * 3. Return to Main Menu
+ */
+int twoDimensionalSubmenu();
 
 /**
  * @brief Allows the user to interactively input pallet data
@@ -130,10 +212,9 @@ void optionIntegerLinearProgramming(unsigned int pallets[], unsigned int weights
  * 2. Number of pallets to enter
  * 3. Data for each pallet in format "palletID weight profit"
  *
- * @return A pointer to an array containing [capacity, n, max_pallets,
- *         followed by flattened arrays of pallets, weights, and profits]
+ * @return The entered instance
  */
-unsigned int *interactiveDataEntry();
+Instance interactiveDataEntry();
 
 /**
  * @brief Displays the approximation algorithm submenu
@@ -143,61 +224,83 @@ unsigned int *interactiveDataEntry();
  * 1. Weight-to-Profit Ratio Greedy Approach
  * 2. Profit-First Greedy Approach
  * 3. Maximum of Both Greedy Approaches
- * 4. Return to Main Menu
+ * 4. Maximum of Both + Local Search Improvement
+ * 5. Parallel Simulated Annealing (Metaheuristic)
+ * 6. Return to Main Menu
  */
 int approximationSubmenu();
 
 /**
  * @brief Handles the weight-to-profit ratio greedy algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
  */
-void optionGreedyRatio(unsigned int pallets[], unsigned int weights[],
-                       unsigned int profits[], unsigned int n,
-                       unsigned int capacity);
+void optionGreedyRatio(const InstanceView &instance);
 
 /**
  * @brief Handles the profit-first greedy algorithm option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
  */
-void optionGreedyProfit(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        unsigned int capacity);
+void optionGreedyProfit(const InstanceView &instance);
 
 /**
  * @brief Handles the maximum of both greedy algorithms option
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
+ */
+void optionGreedyMaximum(const InstanceView &instance);
+
+/**
+ * @brief Handles the greedy maximum algorithm followed by the local-search improvement stage
+ * @param instance Pallets and truck capacity
+ */
+void optionGreedyLocalSearch(const InstanceView &instance);
+
+/**
+ * @brief Handles the parallel simulated annealing metaheuristic option
+ * @param instance Pallets and truck capacity
+ */
+void optionSimulatedAnnealing(const InstanceView &instance);
+
+/**
+ * @brief Keeps the optimum up to date while the user edits the manifest
+ * @param instance Pallets and truck capacity
+ *
+ * Builds an IncrementalKnapsack once, then reads commands until "done":
+ * - add <palletID> <weight> <profit>
+ * - remove <palletID>
+ * - capacity <newCapacity>
+ * - show (prints the selected pallets)
+ * The new optimum is printed after every edit.
+ */
+void optionIncrementalResolve(const InstanceView &instance);
+
+/**
+ * @brief Solves once for the largest of several truck sizes and answers all of them
+ * @param instance Pallets and truck capacity
+ *
+ * Asks for a list of capacities (the instance capacity is always included), prints the
+ * optimum of each, shows the selected pallets of any capacity on request and can export
+ * the full profit-vs-capacity curve to CSV.
+ */
+void optionCapacitySweep(const InstanceView &instance);
+
+/**
+ * @brief Assigns the pallets to a fleet of trucks (multiple knapsack)
+ * @param instance Pallets and truck capacity
+ *
+ * The fleet is read from a CSV in the TruckAndPallets format with one row per truck, or typed
+ * as a list of capacities.
  */
-void optionGreedyMaximum(unsigned int pallets[], unsigned int weights[],
-                         unsigned int profits[], unsigned int n,
-                         unsigned int capacity);
+void optionMultiTruckFleet(const InstanceView &instance);
 
 /**
  * @brief Compares all implemented algorithms and shows performance metrics
- * @param pallets Array of pallet IDs
- * @param weights Array of pallet weights
- * @param profits Array of pallet profits
- * @param n Number of pallets
- * @param capacity Truck capacity
+ * @param instance Pallets and truck capacity
  *
  * Runs each algorithm on the same dataset and displays:
  * - Execution time
  * - Total profit achieved
  * - Solution quality comparison
  */
-void optionCompareAllAlgorithms(unsigned int pallets[], unsigned int weights[],
-                                unsigned int profits[], unsigned int n,
-                                unsigned int capacity);
+void optionCompareAllAlgorithms(const InstanceView &instance);
 
 #endif // MENU_H
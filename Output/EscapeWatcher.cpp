@@ -0,0 +1,87 @@
+#include "EscapeWatcher.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+static const unsigned char ESCAPE_KEY = 27;
+
+static std::atomic<bool> g_pressed{false};
+static std::mutex g_mutex;
+static unsigned int g_users = 0;
+static std::thread g_thread;
+static struct termios g_saved_terminal;
+// written to by release() to wake the thread out of poll()
+static int g_wake_pipe[2] = {-1, -1};
+
+// reads stdin until Esc is pressed or the wake pipe is written to
+static void watchInput(int wakeFd)
+{
+    struct pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {wakeFd, POLLIN, 0}};
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+            continue;
+        if (fds[1].revents != 0)
+            return;
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+            return;
+
+        unsigned char key;
+        if (read(STDIN_FILENO, &key, 1) == 1 && key == ESCAPE_KEY)
+            g_pressed.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool EscapeWatcher::acquire()
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_users > 0)
+    {
+        g_users++;
+        return true;
+    }
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &g_saved_terminal) != 0 || pipe(g_wake_pipe) != 0)
+        return false;
+
+    // keys arrive one at a time and are not echoed for as long as solvers run
+    struct termios raw = g_saved_terminal;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+    g_pressed.store(false, std::memory_order_relaxed);
+    g_thread = std::thread(watchInput, g_wake_pipe[0]);
+    g_users = 1;
+    return true;
+}
+
+void EscapeWatcher::release()
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_users == 0 || --g_users > 0)
+        return;
+
+    char wake = 0;
+    if (write(g_wake_pipe[1], &wake, 1) != 1)
+    {
+        // the pipe is empty and open, so this cannot happen; never leave the thread running
+        close(g_wake_pipe[1]);
+        g_wake_pipe[1] = -1;
+    }
+    g_thread.join();
+    if (g_wake_pipe[1] >= 0)
+        close(g_wake_pipe[1]);
+    close(g_wake_pipe[0]);
+    g_wake_pipe[0] = g_wake_pipe[1] = -1;
+
+    tcsetattr(STDIN_FILENO, TCSANOW, &g_saved_terminal);
+}
+
+bool EscapeWatcher::pressed()
+{
+    return g_pressed.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file EscapeWatcher.h
+ * @brief Background thread that watches the terminal for Esc while solvers run
+ */
+
+#ifndef ESCAPEWATCHER_H
+#define ESCAPEWATCHER_H
+
+/**
+ * @brief Watches stdin for the Esc key on its own thread, so that solvers only read a flag
+ * @note The terminal is switched to non-canonical, no-echo mode once when watching starts and
+ *       restored once when it stops, instead of around every check.
+ * @note Every member is static: there is one terminal, shared by every progress bar and thread.
+ */
+class EscapeWatcher
+{
+public:
+    /**
+     * @brief Registers one more user of the watcher, starting its thread for the first one
+     * @return true if Esc is being watched, false when stdin is not a terminal
+     * @note The pressed flag is cleared when the thread starts, so every run begins uncancelled.
+     */
+    static bool acquire();
+
+    /**
+     * @brief Unregisters a user; the last one stops the thread and restores the terminal
+     * @note Only call it after a successful acquire().
+     */
+    static void release();
+
+    /**
+     * @brief Checks whether Esc was pressed since watching started
+     * @return true once Esc has been read
+     * @note A relaxed atomic load: no syscall, safe from any thread.
+     */
+    static bool pressed();
+};
+
+#endif // ESCAPEWATCHER_H
@@ -1,19 +1,30 @@
 #include "Output.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <chrono>
+#include <cstdio>
 #include <thread>
 #include <limits>
+#include <sstream>
 
-void OutputExhaustiveSolution(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
-                              const BFSol &solution, double executionTime)
+// wall time of a run, then how much of it the thread spent on the CPU in user and kernel mode
+static void printExecutionTime(const TimingSample &timing)
+{
+    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << timing.wall_ms << " ms (user "
+              << timing.user_ms << " ms, sys " << timing.sys_ms << " ms)\n";
+}
+
+void OutputExhaustiveSolution(const unsigned int pallets[], const unsigned int weights[],
+                              const unsigned int profits[], unsigned int n,
+                              const BFSol &solution, const TimingSample &timing)
 {
     std::cout << "\n=========== EXHAUSTIVE SEARCH RESULTS ===========\n";
     std::cout << "Total profit: " << solution.total_profit << "\n";
     std::cout << "Total weight: " << solution.total_weight << "\n";
     std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
-    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << executionTime << " ms\n\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
 
     std::cout << "Selected pallets:\n";
     std::cout << std::setw(10) << "Pallet ID"
@@ -38,17 +49,18 @@ void OutputExhaustiveSolution(unsigned int pallets[], unsigned int weights[],
     std::cin.get();
 }
 
-void OutputDynamicProgramming(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
+void OutputDynamicProgramming(const unsigned int pallets[], const unsigned int weights[],
+                              const unsigned int profits[], unsigned int n,
                               unsigned int totalProfit, unsigned int totalWeight,
                               unsigned int palletCount, const bool usedItems[],
-                              double executionTime)
+                              const TimingSample &timing)
 {
     std::cout << "\n=========== DYNAMIC PROGRAMMING RESULTS ===========\n";
     std::cout << "Total profit: " << totalProfit << "\n";
     std::cout << "Total weight: " << totalWeight << "\n";
     std::cout << "Pallets used: " << palletCount << " / " << n << "\n";
-    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << executionTime << " ms\n\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
 
     std::cout << "Selected pallets:\n";
     std::cout << std::setw(10) << "Pallet ID"
@@ -73,15 +85,16 @@ void OutputDynamicProgramming(unsigned int pallets[], unsigned int weights[],
     std::cin.get();
 }
 
-void OutputBacktracking(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        const BTSol &solution, double executionTime)
+void OutputBacktracking(const unsigned int pallets[], const unsigned int weights[],
+                        const unsigned int profits[], unsigned int n,
+                        const BTSol &solution, const TimingSample &timing)
 {
     std::cout << "\n=========== BACKTRACKING RESULTS ===========\n";
     std::cout << "Total profit: " << solution.total_profit << "\n";
     std::cout << "Total weight: " << solution.total_weight << "\n";
     std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
-    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << executionTime << " ms\n\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
 
     std::cout << "Selected pallets:\n";
     std::cout << std::setw(10) << "Pallet ID"
@@ -106,16 +119,17 @@ void OutputBacktracking(unsigned int pallets[], unsigned int weights[],
     std::cin.get();
 }
 
-void OutputGreedyApproximation(unsigned int pallets[], unsigned int weights[],
-                               unsigned int profits[], unsigned int n,
-                               const GreedySol &solution, double executionTime)
+void OutputGreedyApproximation(const unsigned int pallets[], const unsigned int weights[],
+                               const unsigned int profits[], unsigned int n,
+                               const GreedySol &solution, const TimingSample &timing)
 {
     std::cout << "\n========== GREEDY APPROXIMATION RESULTS ==========\n";
     std::cout << "Algorithm: " << solution.approach_name << "\n";
     std::cout << "Total profit: " << solution.total_profit << "\n";
     std::cout << "Total weight: " << solution.total_weight << "\n";
     std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
-    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << executionTime << " ms\n\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
 
     std::cout << "Selected pallets:\n";
     std::cout << std::setw(10) << "Pallet ID"
@@ -140,16 +154,118 @@ void OutputGreedyApproximation(unsigned int pallets[], unsigned int weights[],
     std::cin.get();
 }
 
-void OutputIntegerLinearProgramming(unsigned int pallets[], unsigned int weights[],
-                            unsigned int profits[], unsigned int n,
-                            unsigned int capacity, int totalProfit, int totalWeight,
-                            const std::vector<int>& selectedIndices, double executionTime)
+void OutputGreedyLocalSearch(const unsigned int pallets[], const unsigned int weights[],
+                             const unsigned int profits[], unsigned int n,
+                             const GreedySol &solution, const LocalSearchStats &stats,
+                             const TimingSample &timing)
+{
+    std::cout << "\n======= GREEDY + LOCAL SEARCH RESULTS =======\n";
+    std::cout << "Algorithm: " << solution.approach_name << "\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
+    std::cout << "Profit gained by local search: " << stats.profit_gained << "\n";
+    std::cout << "Moves made: " << stats.moves_made
+              << " (add " << stats.add_moves
+              << ", drop " << stats.drop_moves
+              << ", 1-for-1 " << stats.swap_moves
+              << ", 2-for-1 " << stats.pair_swap_moves << ")\n";
+    std::cout << "Stopped at: " << (stats.local_optimum ? "local optimum" : "time budget") << "\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
+
+    std::cout << "Selected pallets:\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "----------------------------------------\n";
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << pallets[i]
+                      << std::setw(10) << weights[i]
+                      << std::setw(10) << profits[i] << "\n";
+        }
+    }
+
+    std::cout << "=============================================\n";
+
+    std::cout << "\nPress Enter to return to the algorithms menu...";
+    std::cin.ignore();
+    std::cin.get();
+}
+
+void OutputMetaheuristic(const unsigned int pallets[], const unsigned int weights[],
+                         const unsigned int profits[], unsigned int n,
+                         const MetaheuristicSol &solution, const TimingSample &timing)
+{
+    std::cout << "\n======= SIMULATED ANNEALING RESULTS =======\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
+    std::cout << "LP upper bound: " << solution.upper_bound << "\n";
+    std::cout << "Chains: " << solution.chains << ", moves evaluated: " << solution.iterations << "\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
+
+    std::cout << "Profit over time:\n";
+    std::cout << std::setw(12) << "Time (ms)"
+              << std::setw(12) << "Profit"
+              << std::setw(12) << "Gap (%)" << "\n";
+    std::cout << "------------------------------------\n";
+    for (const ProfitSample &sample : solution.profit_curve)
+    {
+        double gap = solution.upper_bound > 0
+                         ? 100.0 * (solution.upper_bound - sample.profit) / solution.upper_bound
+                         : 0.0;
+        std::cout << std::setw(12) << std::setprecision(3) << sample.time_ms
+                  << std::setw(12) << sample.profit
+                  << std::setw(12) << std::setprecision(2) << gap << "\n";
+    }
+    std::cout << "\n";
+
+    std::cout << "Selected pallets:\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "----------------------------------------\n";
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << pallets[i]
+                      << std::setw(10) << weights[i]
+                      << std::setw(10) << profits[i] << "\n";
+        }
+    }
+
+    std::cout << "==========================================\n";
+
+    std::cout << "\nPress Enter to return to the algorithms menu...";
+    std::cin.ignore();
+    std::cin.get();
+}
+
+void OutputIntegerLinearProgramming(const unsigned int pallets[], const unsigned int weights[],
+                            const unsigned int profits[], unsigned int n,
+                            unsigned int capacity, const ILPSol &solution,
+                            const TimingSample &timing)
 {
     std::cout << "\n=========== INTEGER LINEAR PROGRAMMING RESULTS ===========\n";
-    std::cout << "Total profit: " << totalProfit << "\n";
-    std::cout << "Total weight: " << totalWeight << " / " << capacity << "\n";
-    std::cout << "Pallets used: " << selectedIndices.size() << " / " << n << "\n";
-    std::cout << "Execution time: " << std::fixed << std::setprecision(3) << executionTime << " ms\n\n";
+    std::cout << "Solver: " << solution.solver_name << "\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << " / " << capacity << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << n << "\n";
+    if (solution.nodes_explored > 0)
+    {
+        std::cout << "LP relaxation bound: " << solution.lp_bound << "\n";
+        std::cout << "Nodes explored: " << solution.nodes_explored << "\n";
+    }
+    printExecutionTime(timing);
+    std::cout << "\n";
 
     std::cout << "Selected pallets:\n";
     std::cout << std::setw(10) << "Pallet ID"
@@ -157,10 +273,12 @@ void OutputIntegerLinearProgramming(unsigned int pallets[], unsigned int weights
               << std::setw(10) << "Profit" << "\n";
     std::cout << "----------------------------------------\n";
 
-    for (int index : selectedIndices) {
-        std::cout << std::setw(10) << pallets[index] 
-                  << std::setw(10) << weights[index] 
-                  << std::setw(10) << profits[index] << "\n";
+    for (unsigned int i = 0; i < n; i++) {
+        if (solution.used_pallets[i]) {
+            std::cout << std::setw(10) << pallets[i] 
+                      << std::setw(10) << weights[i] 
+                      << std::setw(10) << profits[i] << "\n";
+        }
     }
 
     std::cout << "===========================================================\n";
@@ -170,23 +288,334 @@ void OutputIntegerLinearProgramming(unsigned int pallets[], unsigned int weights
     std::cin.get();
 }
 
+void OutputOnlineKnapsack(const OnlineKnapsack &solver, const OnlineSol &solution)
+{
+    const std::vector<unsigned int> &pallets = solver.palletIds();
+    const std::vector<unsigned int> &weights = solver.palletWeights();
+    const std::vector<unsigned int> &profits = solver.palletProfits();
+
+    std::cout << "\n======= STREAMING (ONLINE DP) RESULTS =======\n";
+    std::cout << "Truck capacity: " << solver.truckCapacity() << "\n";
+    std::cout << "Pallets received: " << solver.size() << "\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << solver.size() << "\n\n";
+
+    std::cout << "Selected pallets:\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "----------------------------------------\n";
+
+    for (unsigned int i = 0; i < solver.size(); i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << pallets[i]
+                      << std::setw(10) << weights[i]
+                      << std::setw(10) << profits[i] << "\n";
+        }
+    }
+
+    std::cout << "=============================================\n";
+}
+
+void OutputIncrementalKnapsack(const Instance &manifest, const IncrementalSol &solution)
+{
+    std::cout << "\n======= INCREMENTAL RE-SOLVE RESULTS =======\n";
+    std::cout << "Truck capacity: " << manifest.capacity << "\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << manifest.size() << "\n\n";
+
+    std::cout << "Selected pallets:\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "----------------------------------------\n";
+
+    for (unsigned int i = 0; i < manifest.size(); i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << manifest.pallets[i]
+                      << std::setw(10) << manifest.weights[i]
+                      << std::setw(10) << manifest.profits[i] << "\n";
+        }
+    }
+
+    std::cout << "============================================\n";
+}
+
+void OutputCapacitySweep(const std::vector<unsigned int> &capacities, const CapacitySweep &sweep,
+                         const TimingSample &timing)
+{
+    std::cout << "\n======= CAPACITY SWEEP RESULTS =======\n";
+    std::cout << "Solved once for capacity " << sweep.maxCapacity() << "\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
+
+    std::cout << std::setw(10) << "Capacity"
+              << std::setw(10) << "Profit"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Pallets" << "\n";
+    std::cout << "----------------------------------------\n";
+    for (unsigned int capacity : capacities)
+    {
+        OnlineSol solution = sweep.solutionAt(capacity);
+        std::cout << std::setw(10) << capacity
+                  << std::setw(10) << solution.total_profit
+                  << std::setw(10) << solution.total_weight
+                  << std::setw(10) << solution.pallet_count << "\n";
+    }
+    std::cout << "======================================\n";
+}
+
+void OutputCapacitySelection(const InstanceView &instance, unsigned int capacity, const OnlineSol &solution)
+{
+    std::cout << "\nCapacity " << capacity << ": profit " << solution.total_profit
+              << ", weight " << solution.total_weight << ", " << solution.pallet_count << " pallet(s)\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "----------------------------------------\n";
+
+    for (unsigned int i = 0; i < instance.n; i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << instance.pallets[i]
+                      << std::setw(10) << instance.weights[i]
+                      << std::setw(10) << instance.profits[i] << "\n";
+        }
+    }
+}
+
+void OutputMultiTruckFleet(const unsigned int pallets[], const unsigned int weights[],
+                           const unsigned int profits[], unsigned int n,
+                           const FleetSol &solution, const TimingSample &timing)
+{
+    std::cout << "\n======= MULTI-TRUCK FLEET RESULTS =======\n";
+    std::cout << std::setw(8) << "Truck"
+              << std::setw(10) << "Capacity"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Profit"
+              << std::setw(10) << "Pallets"
+              << std::setw(10) << "Used (%)" << "\n";
+    std::cout << "----------------------------------------------------------\n";
+    for (unsigned int t = 0; t < solution.trucks.size(); t++)
+    {
+        const TruckLoad &truck = solution.trucks[t];
+        double used = truck.capacity > 0 ? 100.0 * truck.total_weight / truck.capacity : 0.0;
+        std::cout << std::setw(8) << t + 1
+                  << std::setw(10) << truck.capacity
+                  << std::setw(10) << truck.total_weight
+                  << std::setw(10) << truck.total_profit
+                  << std::setw(10) << truck.pallets.size()
+                  << std::setw(10) << std::fixed << std::setprecision(1) << used << "\n";
+    }
+    std::cout << "----------------------------------------------------------\n";
+
+    double gap = solution.upper_bound > 0
+                     ? 100.0 * (solution.upper_bound - solution.total_profit) / solution.upper_bound
+                     : 0.0;
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << "\n";
+    std::cout << "Pallets loaded: " << solution.pallet_count << " / " << n << "\n";
+    std::cout << "Surrogate upper bound: " << solution.upper_bound
+              << " (gap " << std::setprecision(2) << gap << "%)\n";
+    std::cout << "Improvement rounds: " << solution.rounds << "\n";
+    printExecutionTime(timing);
+
+    for (unsigned int t = 0; t < solution.trucks.size(); t++)
+    {
+        std::cout << "\nTruck " << t + 1 << ":\n";
+        std::cout << std::setw(10) << "Pallet ID"
+                  << std::setw(10) << "Weight"
+                  << std::setw(10) << "Profit" << "\n";
+        std::cout << "----------------------------------------\n";
+        for (unsigned int pallet : solution.trucks[t].pallets)
+        {
+            std::cout << std::setw(10) << pallets[pallet]
+                      << std::setw(10) << weights[pallet]
+                      << std::setw(10) << profits[pallet] << "\n";
+        }
+    }
+
+    std::cout << "==========================================\n";
+
+    std::cout << "\nPress Enter to return to the algorithms menu...";
+    std::cin.get();
+}
+
+void OutputTwoDimensional(const InstanceView &instance, const TwoDimSol &solution, const TimingSample &timing)
+{
+    std::cout << "\n======= WEIGHT + VOLUME LOADING RESULTS =======\n";
+    std::cout << "Solver: " << solution.solver_name << "\n";
+    std::cout << "Total profit: " << solution.total_profit << "\n";
+    std::cout << "Total weight: " << solution.total_weight << " / " << instance.capacity << "\n";
+    std::cout << "Total volume: " << solution.total_volume << " / " << instance.volume_capacity << "\n";
+    std::cout << "Pallets used: " << solution.pallet_count << " / " << instance.n << "\n";
+    std::cout << "Surrogate upper bound: " << solution.upper_bound << "\n";
+    if (solution.nodes_explored > 0)
+        std::cout << "Nodes explored: " << solution.nodes_explored << "\n";
+    printExecutionTime(timing);
+    std::cout << "\n";
+
+    std::cout << "Selected pallets:\n";
+    std::cout << std::setw(10) << "Pallet ID"
+              << std::setw(10) << "Weight"
+              << std::setw(10) << "Volume"
+              << std::setw(10) << "Profit" << "\n";
+    std::cout << "--------------------------------------------------\n";
+
+    for (unsigned int i = 0; i < instance.n; i++)
+    {
+        if (solution.used_pallets[i])
+        {
+            std::cout << std::setw(10) << instance.pallets[i]
+                      << std::setw(10) << instance.weights[i]
+                      << std::setw(10) << instance.volumes[i]
+                      << std::setw(10) << instance.profits[i] << "\n";
+        }
+    }
+
+    std::cout << "===============================================\n";
+
+    std::cout << "\nPress Enter to return to the algorithms menu...";
+    std::cin.ignore();
+    std::cin.get();
+}
+
+std::string jsonQuote(const std::string &text)
+{
+    std::string quoted = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            quoted += '\\';
+            quoted += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            quoted += escape;
+        }
+        else
+        {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+// milliseconds with three decimals, without touching the flags of the output stream
+static std::string formatMilliseconds(double ms)
+{
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(3) << ms;
+    return text.str();
+}
+
+void OutputSolverResultJson(std::ostream &out, const InstanceView &instance, const SolverResult &result)
+{
+    out << "{\"solver\":" << jsonQuote(result.solver)
+        << ",\"status\":" << (result.ran ? "\"ok\"" : "\"skipped\"");
+    if (!result.message.empty())
+        out << ",\"message\":" << jsonQuote(result.message);
+    if (result.ran)
+    {
+        out << ",\"profit\":" << result.total_profit
+            << ",\"weight\":" << result.total_weight;
+        if (instance.volumes != nullptr)
+            out << ",\"volume\":" << result.total_volume;
+        out << ",\"pallet_count\":" << result.pallet_count
+            << ",\"optimal\":" << (result.optimal ? "true" : "false");
+        if (result.cached)
+            out << ",\"cached\":true";
+    }
+    out << ",\"time_ms\":" << formatMilliseconds(result.elapsed_ms)
+        << ",\"user_ms\":" << formatMilliseconds(result.user_ms)
+        << ",\"sys_ms\":" << formatMilliseconds(result.sys_ms);
+    if (result.ran)
+    {
+        out << ",\"pallets\":[";
+        bool first = true;
+        for (unsigned int i = 0; i < instance.n; i++)
+        {
+            if (result.used_pallets[i])
+            {
+                out << (first ? "" : ",") << instance.pallets[i];
+                first = false;
+            }
+        }
+        out << "]";
+    }
+    out << "}";
+}
+
+void OutputSolverResultText(std::ostream &out, const InstanceView &instance, const SolverResult &result)
+{
+    out << std::left << std::setw(14) << result.solver << std::right;
+    if (!result.ran)
+    {
+        out << "skipped: " << result.message << "\n";
+        return;
+    }
+
+    out << "profit " << result.total_profit
+        << "  weight " << result.total_weight << "/" << instance.capacity;
+    if (instance.volumes != nullptr)
+        out << "  volume " << result.total_volume << "/" << instance.volume_capacity;
+    out << "  pallets " << result.pallet_count
+        << "  " << formatMilliseconds(result.elapsed_ms) << " ms"
+        << (result.optimal ? "  optimal" : "") << (result.cached ? "  cached" : "");
+    if (!result.message.empty())
+        out << "  (" << result.message << ")";
+    out << "\n";
+
+    out << std::setw(14) << "" << "selected:";
+    for (unsigned int i = 0; i < instance.n; i++)
+    {
+        if (result.used_pallets[i])
+            out << " " << instance.pallets[i];
+    }
+    out << "\n";
+}
+
 void OutputCompareAllAlgorithms(const std::vector<std::string>& names, 
-                                const std::vector<double>& times, 
+                                const std::vector<TimingSample>& times, 
                                 const std::vector<std::string>& spaceComplexities, 
                                 const std::vector<std::string>& accuracyAlgorithms,
-                                const std::vector<unsigned int>& profits) {
-    double maxTime = *std::max_element(times.begin(), times.end());
-    unsigned int maxProfit = *std::max_element(profits.begin(), profits.end());
+                                const std::vector<unsigned int>& profits,
+                                const std::vector<bool>& respectsLimit) {
+    double maxTime = 0.0;
+    for (const TimingSample& time : times) {
+        maxTime = std::max(maxTime, time.wall_ms);
+    }
+    // only loadings that respect the pallet limit can set the reference profit
+    unsigned int maxProfit = 0;
+    bool anyIgnoresLimit = false;
+    for (size_t i = 0; i < profits.size(); ++i) {
+        if (respectsLimit[i]) {
+            maxProfit = std::max(maxProfit, profits[i]);
+        }
+        else {
+            anyIgnoresLimit = true;
+        }
+    }
     int chartWidth = 40;
     std::cout << "\nAlgorithm Performance Comparison:\n";
-    std::cout << "-------------------------------------------------------------------------\n";
-    std::cout << "Algorithm           | Time (ms) | Profit | Space Complexity | Accuracy(%) \n";
-    std::cout << "-------------------------------------------------------------------------\n";
+    std::cout << "---------------------------------------------------------------------------------------------\n";
+    std::cout << "Algorithm           | Wall (ms) | User (ms) | Sys (ms)  | Profit | Space Complexity | Accuracy(%) \n";
+    std::cout << "---------------------------------------------------------------------------------------------\n";
     for (size_t i = 0; i < names.size(); ++i) {
-        int barLen = maxTime > 0 ? static_cast<int>((times[i] / maxTime) * chartWidth) : 0;
+        int barLen = maxTime > 0 ? static_cast<int>((times[i].wall_ms / maxTime) * chartWidth) : 0;
         
         std::string profitStr = std::to_string(profits[i]);
-        if (profits[i] == maxProfit && maxProfit > 0) {
+        if (respectsLimit[i] && profits[i] == maxProfit && maxProfit > 0) {
             profitStr += " *"; // mark best profit with an asterisk
         }
         
@@ -194,14 +623,25 @@ void OutputCompareAllAlgorithms(const std::vector<std::string>& names,
             static_cast<double>(profits[i]) / maxProfit * 100.0 : 0.0;
         
         std::cout << std::left << std::setw(20) << names[i]
-                  << "| " << std::setw(9) << std::fixed << std::setprecision(3) << times[i]
+                  << "| " << std::setw(9) << std::fixed << std::setprecision(3) << times[i].wall_ms
+                  << " | " << std::setw(9) << times[i].user_ms
+                  << " | " << std::setw(9) << times[i].sys_ms << " "
                   << "| " << std::setw(7) << profitStr
-                  << "| " << std::setw(17) << spaceComplexities[i]
-                  << "| " << std::setw(10) << std::fixed << std::setprecision(1) << accuracyPercent;
+                  << "| " << std::setw(17) << spaceComplexities[i] << "| ";
+        if (respectsLimit[i]) {
+            std::cout << std::setw(10) << std::fixed << std::setprecision(1) << accuracyPercent;
+        }
+        else {
+            std::cout << std::setw(10) << "N/A";
+        }
         std::cout << "\n";
     }
-    std::cout << "-------------------------------------------------------------------------\n";
+    std::cout << "---------------------------------------------------------------------------------------------\n";
     std::cout << "* Indicates optimal profit\n";
+    if (anyIgnoresLimit) {
+        std::cout << "N/A: the algorithm ignores the pallet limit, so its profit is not compared\n";
+    }
+    std::cout << "Times cover the computation only; user and sys are CPU time of the calling thread\n";
     std::cout << "Accuracy: algorithm profit / optimal profit × 100\n";
     std::cout << "\nPress Enter to return to the algorithms menu...";
     std::cin.ignore();
@@ -11,6 +11,17 @@
 #include "../Approaches/Exhaustive.h"
 #include "../Approaches/Greedy.h"
 #include "../Approaches/Backtracking.h"
+#include "../Approaches/LocalSearch.h"
+#include "../Approaches/Metaheuristic.h"
+#include "../Approaches/IntegerProgramming.h"
+#include "../Approaches/OnlineKnapsack.h"
+#include "../Approaches/IncrementalKnapsack.h"
+#include "../Approaches/CapacitySweep.h"
+#include "../Approaches/MultipleKnapsack.h"
+#include "../Approaches/TwoDimensional.h"
+#include "../Approaches/SolverRegistry.h"
+#include "../Utils/Timing.h"
+#include <ostream>
 
 /**
  * @brief Displays the results of the exhaustive search algorithm
@@ -19,11 +30,11 @@
  * @param profits Array of pallet profits
  * @param n Number of pallets
  * @param solution The solution structure returned by the exhaustive algorithm
- * @param executionTime Time taken to execute the algorithm in milliseconds
+ * @param timing Wall, user and sys time of the algorithm
  */
-void OutputExhaustiveSolution(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
-                              const BFSol &solution, double executionTime);
+void OutputExhaustiveSolution(const unsigned int pallets[], const unsigned int weights[],
+                              const unsigned int profits[], unsigned int n,
+                              const BFSol &solution, const TimingSample &timing);
 
 /**
  * @brief Displays the results of the dynamic programming algorithm
@@ -35,13 +46,13 @@ void OutputExhaustiveSolution(unsigned int pallets[], unsigned int weights[],
  * @param totalWeight Total weight of the selected pallets
  * @param palletCount Number of pallets selected in the solution
  * @param usedItems Boolean array indicating which pallets were selected
- * @param executionTime Time taken to execute the algorithm in milliseconds
+ * @param timing Wall, user and sys time of the algorithm
  */
-void OutputDynamicProgramming(unsigned int pallets[], unsigned int weights[],
-                              unsigned int profits[], unsigned int n,
+void OutputDynamicProgramming(const unsigned int pallets[], const unsigned int weights[],
+                              const unsigned int profits[], unsigned int n,
                               unsigned int totalProfit, unsigned int totalWeight,
                               unsigned int palletCount, const bool usedItems[],
-                              double executionTime);
+                              const TimingSample &timing);
 
 /**
  * @brief Displays the results of the backtracking algorithm
@@ -50,11 +61,11 @@ void OutputDynamicProgramming(unsigned int pallets[], unsigned int weights[],
  * @param profits Array of pallet profits
  * @param n Number of pallets
  * @param solution The solution structure returned by the backtracking algorithm
- * @param executionTime Time taken to execute the algorithm in milliseconds
+ * @param timing Wall, user and sys time of the algorithm
  */
-void OutputBacktracking(unsigned int pallets[], unsigned int weights[],
-                        unsigned int profits[], unsigned int n,
-                        const BTSol &solution, double executionTime);
+void OutputBacktracking(const unsigned int pallets[], const unsigned int weights[],
+                        const unsigned int profits[], unsigned int n,
+                        const BTSol &solution, const TimingSample &timing);
 
 /**
  * @brief Displays the results of the greedy approximation algorithms
@@ -63,11 +74,39 @@ void OutputBacktracking(unsigned int pallets[], unsigned int weights[],
  * @param profits Array of pallet profits
  * @param n Number of pallets
  * @param solution The solution structure returned by the greedy algorithm
- * @param executionTime Time taken to execute the algorithm in milliseconds
+ * @param timing Wall, user and sys time of the algorithm
  */
-void OutputGreedyApproximation(unsigned int pallets[], unsigned int weights[],
-                               unsigned int profits[], unsigned int n,
-                               const GreedySol &solution, double executionTime);
+void OutputGreedyApproximation(const unsigned int pallets[], const unsigned int weights[],
+                               const unsigned int profits[], unsigned int n,
+                               const GreedySol &solution, const TimingSample &timing);
+
+/**
+ * @brief Displays the results of a greedy approximation improved by local search
+ * @param pallets Array of pallet IDs
+ * @param weights Array of pallet weights
+ * @param profits Array of pallet profits
+ * @param n Number of pallets
+ * @param solution The improved solution structure
+ * @param stats Profit gained and moves made by the improvement stage
+ * @param timing Wall, user and sys time of both stages
+ */
+void OutputGreedyLocalSearch(const unsigned int pallets[], const unsigned int weights[],
+                             const unsigned int profits[], unsigned int n,
+                             const GreedySol &solution, const LocalSearchStats &stats,
+                             const TimingSample &timing);
+
+/**
+ * @brief Displays the results of the parallel simulated annealing metaheuristic
+ * @param pallets Array of pallet IDs
+ * @param weights Array of pallet weights
+ * @param profits Array of pallet profits
+ * @param n Number of pallets
+ * @param solution The solution structure returned by the metaheuristic, including its profit-vs-time curve
+ * @param timing Wall, user and sys time of the algorithm
+ */
+void OutputMetaheuristic(const unsigned int pallets[], const unsigned int weights[],
+                         const unsigned int profits[], unsigned int n,
+                         const MetaheuristicSol &solution, const TimingSample &timing);
 
 /**
  * @brief Displays the results of the integer linear programming algorithm
@@ -76,31 +115,109 @@ void OutputGreedyApproximation(unsigned int pallets[], unsigned int weights[],
  * @param profits Array of pallet profits
  * @param n Number of pallets
  * @param capacity Maximum truck capacity
- * @param totalProfit Total profit achieved by the solution
- * @param totalWeight Total weight of the selected pallets
- * @param selectedIndices Vector of indices of the selected pallets
- * @param executionTime Time taken to execute the algorithm in milliseconds
+ * @param solution The solution structure returned by the native or the Python ILP solver
+ * @param timing Wall, user and sys time of the algorithm
+ */
+void OutputIntegerLinearProgramming(const unsigned int pallets[], const unsigned int weights[],
+                                    const unsigned int profits[], unsigned int n,
+                                    unsigned int capacity, const ILPSol &solution,
+                                    const TimingSample &timing);
+
+/**
+ * @brief Displays the final result of a streaming (online) run
+ * @param solver Online solver holding the pallets that arrived
+ * @param solution Optimum over those pallets
+ */
+void OutputOnlineKnapsack(const OnlineKnapsack &solver, const OnlineSol &solution);
+
+/**
+ * @brief Displays the current optimum of an incremental re-solve session
+ * @param manifest Current pallets and truck capacity
+ * @param solution Optimum over the manifest, indexed like it
+ */
+void OutputIncrementalKnapsack(const Instance &manifest, const IncrementalSol &solution);
+
+/**
+ * @brief Displays the optimum of every capacity of a capacity sweep
+ * @param capacities Queried truck capacities
+ * @param sweep Sweep solved for the largest of them
+ * @param timing Wall, user and sys time of the DP pass
+ */
+void OutputCapacitySweep(const std::vector<unsigned int> &capacities, const CapacitySweep &sweep,
+                         const TimingSample &timing);
+
+/**
+ * @brief Displays the pallets selected for one capacity of a capacity sweep
+ * @param instance Pallets the sweep was solved for
+ * @param capacity Queried truck capacity
+ * @param solution Optimum for that capacity
+ */
+void OutputCapacitySelection(const InstanceView &instance, unsigned int capacity, const OnlineSol &solution);
+
+/**
+ * @brief Displays the per-truck loads of a fleet solution
+ * @param pallets Array of pallet IDs
+ * @param weights Array of pallet weights
+ * @param profits Array of pallet profits
+ * @param n Number of pallets
+ * @param solution The fleet solution
+ * @param timing Wall, user and sys time of the algorithm
+ */
+void OutputMultiTruckFleet(const unsigned int pallets[], const unsigned int weights[],
+                           const unsigned int profits[], unsigned int n,
+                           const FleetSol &solution, const TimingSample &timing);
+
+/**
+ * @brief Displays a weight + volume loading
+ * @param instance Pallets, with their volumes, and truck capacities
+ * @param solution The loading to display
+ * @param timing Wall, user and sys time of the algorithm
+ */
+void OutputTwoDimensional(const InstanceView &instance, const TwoDimSol &solution, const TimingSample &timing);
+
+/**
+ * @brief Quotes and escapes a string for JSON output
+ * @param text Text to quote
+ * @return The text between double quotes, with quotes, backslashes and control characters escaped
+ */
+std::string jsonQuote(const std::string &text);
+
+/**
+ * @brief Writes the result of a registered solver as one JSON object, without a trailing newline
+ * @param out Stream to write to
+ * @param instance Instance the solver ran on (for the pallet IDs)
+ * @param result The solver result
+ * @note Fields: solver, status ("ok" or "skipped"), message (only when set), profit, weight,
+ *       volume (only with volumes), pallet_count, optimal, time_ms and pallets (selected pallet IDs).
+ */
+void OutputSolverResultJson(std::ostream &out, const InstanceView &instance, const SolverResult &result);
+
+/**
+ * @brief Writes the result of a registered solver as plain text: a summary line and the selected pallet IDs
+ * @param out Stream to write to
+ * @param instance Instance the solver ran on (for the pallet IDs)
+ * @param result The solver result
  */
-void OutputIntegerLinearProgramming(unsigned int pallets[], unsigned int weights[],
-                                    unsigned int profits[], unsigned int n,
-                                    unsigned int capacity, int totalProfit, int totalWeight,
-                                    const std::vector<int> &selectedIndices, double executionTime);
+void OutputSolverResultText(std::ostream &out, const InstanceView &instance, const SolverResult &result);
 
 /**
  * @brief Displays comparative results for all implemented algorithms
  * @param names Vector of algorithm names
- * @param times Vector of execution times for each algorithm
+ * @param times Wall-clock, user and system time of each algorithm's compute phase
  * @param spaceComplexities Vector of space complexity descriptions
  * @param accuracyAlgorithms Vector of accuracy/optimality descriptions
  * @param profits Vector of total profits achieved by each algorithm
+ * @param respectsLimit Whether each algorithm's loading respects the pallet limit; the others are
+ *                      left out of the best profit and shown without an accuracy
  *
  * @note Displays a comparative table with performance metrics for all algorithms,
  * including execution time, space complexity, accuracy, and solution quality.
  */
 void OutputCompareAllAlgorithms(const std::vector<std::string> &names,
-                                const std::vector<double> &times,
+                                const std::vector<TimingSample> &times,
                                 const std::vector<std::string> &spaceComplexities,
                                 const std::vector<std::string> &accuracyAlgorithms,
-                                const std::vector<unsigned int> &profits);
+                                const std::vector<unsigned int> &profits,
+                                const std::vector<bool> &respectsLimit);
 
 #endif // OUTPUT_H
@@ -1,29 +1,82 @@
 #include "ProgressBar.h"
+#include "EscapeWatcher.h"
 #include <iostream>
+#include <algorithm>
 #include <iomanip>
-#include <thread>
-#include <termios.h>
-#include <unistd.h>
-#include <fcntl.h>
 
-ProgressBar::ProgressBar(unsigned long long total, bool hidden) : 
+bool ProgressBar::headless = false;
+
+ProgressBar::ProgressBar(unsigned long long total, bool hidden, unsigned int counterCount) : 
     total_iterations(total), 
-    current_iteration(0),
+    counters(counterCount == 0 ? 1 : counterCount),
     visible(false),
     escape_message_shown(false),
-    hidden_mode(hidden) {
-    start_time = std::chrono::high_resolution_clock::now();
+    hidden_mode(hidden || headless),
+    watching_escape(false),
+    renderer_stopped(false) {
+    start_time = std::chrono::steady_clock::now();
+}
+
+ProgressBar::~ProgressBar() {
+    // the renderer reads this bar, so it goes first
+    stopRenderer();
+    if (watching_escape) {
+        EscapeWatcher::release();
+    }
 }
 
-bool ProgressBar::update(unsigned long long iteration) {
-    current_iteration = iteration;
+bool ProgressBar::update(unsigned long long iteration, unsigned int counter) {
+    counters[counter].value.store(iteration, std::memory_order_relaxed);
     
     if (hidden_mode) {
         return !checkCancellation();
     }
     
+    std::call_once(renderer_started, [this] { startRenderer(); });
+    
+    if (checkForEscapeKey()) {
+        // nothing may be drawn after the solver's cancellation message
+        stopRenderer();
+        return false;
+    }
+    
+    return true;
+}
+
+void ProgressBar::startRenderer() {
+    std::lock_guard<std::mutex> lock(renderer_control);
+    if (!renderer_stopped) {
+        renderer = std::jthread([this](std::stop_token stop) { render(stop); });
+    }
+}
+
+void ProgressBar::stopRenderer() {
+    std::lock_guard<std::mutex> lock(renderer_control);
+    renderer_stopped = true;
+    if (renderer.joinable()) {
+        renderer.request_stop();
+        renderer.join();
+    }
+}
+
+void ProgressBar::render(std::stop_token stop) {
+    std::unique_lock<std::mutex> lock(render_mutex);
+    while (!stop.stop_requested()) {
+        unsigned long long iterations = 0;
+        for (const ProgressCounter &counter : counters) {
+            iterations += counter.value.load(std::memory_order_relaxed);
+        }
+        draw(iterations);
+        showEscapeMessageIfNeeded();
+        
+        // a stop request wakes the wait at once
+        render_wake.wait_for(lock, stop, RENDER_INTERVAL, [] { return false; });
+    }
+}
+
+void ProgressBar::draw(unsigned long long iterations) {
     // calculate the progress percentage
-    float progress = static_cast<float>(current_iteration) / total_iterations;
+    float progress = std::min(1.0f, static_cast<float>(iterations) / total_iterations);
     int bar_position = static_cast<int>(progress * BAR_WIDTH);
     int percent = static_cast<int>(progress * 100);
     
@@ -35,14 +88,6 @@ bool ProgressBar::update(unsigned long long iteration) {
     std::cout << "] " << std::setw(3) << percent << "%" << std::flush;
     
     visible = true;
-    
-    showEscapeMessageIfNeeded();
-    
-    if (checkForEscapeKey()) {
-        return false;
-    }
-    
-    return true;
 }
 
 void ProgressBar::complete() {
@@ -50,21 +95,15 @@ void ProgressBar::complete() {
         return;
     }
     
+    stopRenderer();
+    
     if (visible) {
-        // update to 100%
+        // leave the finished bar on its own line: pausing here would count as solver time
         std::cout << "\r[";
         for (int i = 0; i < BAR_WIDTH; ++i) {
             std::cout << "=";
         }
-        std::cout << "] 100%" << std::flush;
-        
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-        
-        // clear the progress bar and any escape message
-        std::cout << "\r" << std::string(BAR_WIDTH + 10, ' ') << "\r" << std::flush;
-        if (escape_message_shown) {
-            std::cout << std::string(60, ' ') << "\r" << std::flush;
-        }
+        std::cout << "] 100%" << std::endl;
     }
 }
 
@@ -73,7 +112,7 @@ bool ProgressBar::shouldShow(int timeThresholdMs) {
         return false;
     }
     
-    auto now = std::chrono::high_resolution_clock::now();
+    auto now = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start_time).count();
     
     // only show the progress bar if the operation has been running for more than the threshold
@@ -81,25 +120,10 @@ bool ProgressBar::shouldShow(int timeThresholdMs) {
 }
 
 bool ProgressBar::checkForEscapeKey() {
-    struct termios oldt, newt;
-    int oldf;
-    
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
-    
-    // check for the esc key
-    int ch = getchar();
-    bool escapePressed = (ch == 27);
+    // the watcher starts on the first check, so runs that finish quickly never touch the terminal
+    std::call_once(escape_watch_started, [this] { watching_escape = !headless && EscapeWatcher::acquire(); });
     
-    // restore terminal settings
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
-    
-    return escapePressed;
+    return watching_escape && EscapeWatcher::pressed();
 }
 
 bool ProgressBar::showEscapeMessageIfNeeded() {
@@ -107,7 +131,7 @@ bool ProgressBar::showEscapeMessageIfNeeded() {
         return true;
     }
     
-    auto now = std::chrono::high_resolution_clock::now();
+    auto now = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - start_time).count();
     
     // show message after a minute
@@ -123,6 +147,10 @@ bool ProgressBar::showEscapeMessageIfNeeded() {
 }
 
 void ProgressBar::showLargeDatasetMessage(const std::string& message) {
+    if (headless) {
+        return;
+    }
+    
     std::cout << "\nThis will take a while (not even the progress bar wanted to be here)." << std::endl;
     if (!message.empty()) {
         std::cout << message << std::endl;
@@ -131,7 +159,12 @@ void ProgressBar::showLargeDatasetMessage(const std::string& message) {
 }
 
 bool ProgressBar::checkCancellation() {
-    auto now = std::chrono::high_resolution_clock::now();
+    // nobody is there to press Esc, and stdin may carry input meant for someone else
+    if (headless) {
+        return false;
+    }
+    
+    auto now = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - start_time).count();
     
     if (duration > 60 && !escape_message_shown) {
@@ -145,4 +178,12 @@ bool ProgressBar::checkCancellation() {
     }
     
     return false;
-}
\ No newline at end of file
+}
+
+void ProgressBar::setHeadless(bool enabled) {
+    headless = enabled;
+}
+
+bool ProgressBar::isHeadless() {
+    return headless;
+}
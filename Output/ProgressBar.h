@@ -9,45 +9,119 @@
 #include <iostream>
 #include <string>
 #include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief One progress counter, alone on its cache line so that threads publishing to different
+ *        counters never share a line
+ * @var ProgressCounter::value Iterations done, written with relaxed stores
+ */
+struct alignas(64) ProgressCounter
+{
+    std::atomic<unsigned long long> value{0};
+};
 
 /**
  * @brief Class for displaying a progress bar during long-running operations
  * @var ProgressBar::BAR_WIDTH Width of the progress bar in characters
+ * @var ProgressBar::RENDER_INTERVAL Time between two redraws of the bar (10 Hz)
  * @var ProgressBar::total_iterations Total number of iterations for the operation
- * @var ProgressBar::current_iteration Current iteration count
+ * @var ProgressBar::counters Iteration counters published by the solver threads, summed when drawn
  * @var ProgressBar::start_time Operation start time
  * @var ProgressBar::visible Whether the progress bar is currently visible
  * @var ProgressBar::escape_message_shown Whether the escape key message has been shown
  * @var ProgressBar::hidden_mode Whether the progress bar is in hidden mode
+ * @var ProgressBar::escape_watch_started Set by the first Esc check, which tries to start the EscapeWatcher
+ * @var ProgressBar::watching_escape Whether this bar holds the EscapeWatcher
+ * @var ProgressBar::renderer_started Set by the first update of a visible bar, which starts the renderer
+ * @var ProgressBar::renderer_stopped Whether the renderer was stopped (it is never restarted)
+ * @var ProgressBar::renderer_control Serializes starting and stopping the renderer
+ * @var ProgressBar::renderer Thread drawing the bar
+ * @var ProgressBar::render_mutex Mutex the renderer sleeps on between redraws
+ * @var ProgressBar::render_wake Wakes the renderer early when it is stopped
+ * @var ProgressBar::headless Whether the program runs without a terminal user (shared by all bars)
+ * @note Solvers only store their iteration counts (relaxed atomics) and read the Esc flag; all
+ *       terminal output of a visible bar happens on the renderer thread.
  */
 class ProgressBar
 {
 private:
     static const int BAR_WIDTH = 70;
+    static constexpr std::chrono::milliseconds RENDER_INTERVAL{100};
     unsigned long long total_iterations;
-    unsigned long long current_iteration;
-    std::chrono::time_point<std::chrono::high_resolution_clock> start_time;
+    std::vector<ProgressCounter> counters;
+    std::chrono::time_point<std::chrono::steady_clock> start_time;
     bool visible;
     bool escape_message_shown;
     bool hidden_mode;
+    std::once_flag escape_watch_started;
+    bool watching_escape;
+    std::once_flag renderer_started;
+    bool renderer_stopped;
+    std::mutex renderer_control;
+    std::jthread renderer;
+    std::mutex render_mutex;
+    std::condition_variable_any render_wake;
+    static bool headless;
+
+    /**
+     * @brief Renderer thread body: draws the bar every RENDER_INTERVAL until stopped
+     * @param stop Stop token of the renderer thread
+     */
+    void render(std::stop_token stop);
+
+    /**
+     * @brief Draws the bar at the given progress
+     * @param iterations Iterations done, summed over the counters
+     */
+    void draw(unsigned long long iterations);
+
+    /**
+     * @brief Starts the renderer thread, unless it was already stopped
+     */
+    void startRenderer();
+
+    /**
+     * @brief Stops and joins the renderer thread, if it runs
+     */
+    void stopRenderer();
 
 public:
     /**
      * @brief Constructs a new Progress Bar object
      * @param total The total number of iterations that the algorithm will perform
      * @param hidden If true, no progress bar will be shown but escape key detection will still work
+     * @param counterCount Number of counters, one per solver thread that publishes progress
+     *                     (e.g. one per simulated annealing chain)
      */
-    ProgressBar(unsigned long long total, bool hidden = false);
+    ProgressBar(unsigned long long total, bool hidden = false, unsigned int counterCount = 1);
+
+    /**
+     * @brief Stops the renderer and releases the EscapeWatcher if this bar started watching
+     */
+    ~ProgressBar();
+
+    ProgressBar(const ProgressBar &) = delete;
+    ProgressBar &operator=(const ProgressBar &) = delete;
 
     /**
      * @brief Updates the progress bar with the current iteration
-     * @param iteration The current iteration number
+     * @param iteration The current iteration number (of this counter)
+     * @param counter Counter to publish to; threads that share a bar each use their own
      * @return true if user wants to continue, false if escape was pressed
+     * @note A relaxed store and a relaxed load: the bar is drawn by its renderer thread, and
+     *       only the first call of a visible bar (which starts that thread) costs more.
      */
-    bool update(unsigned long long iteration);
+    bool update(unsigned long long iteration, unsigned int counter = 0);
 
     /**
-     * @brief Completes the progress bar and removes it from the screen after 1 second
+     * @brief Completes the progress bar: stops the renderer and leaves a full bar on its own line
+     * @note Returns at once, so that it adds nothing to the solver's measured time.
      */
     void complete();
 
@@ -61,6 +135,8 @@ public:
     /**
      * @brief Checks if escape key has been pressed
      * @return true if escape key has been pressed, false otherwise
+     * @note The first call starts watching stdin on a background thread (EscapeWatcher); every
+     *       call only reads the flag that thread sets, so no terminal syscall is made here.
      */
     bool checkForEscapeKey();
 
@@ -81,6 +157,20 @@ public:
      * @return true if escape was pressed, false otherwise
      */
     bool checkCancellation();
+
+    /**
+     * @brief Switches every progress bar to headless mode, for runs without a terminal user
+     * @param enabled If true, bars are never drawn, messages are not printed, stdin is never
+     *                polled for Esc and complete() prints nothing
+     * @note Set it once, before any solver runs.
+     */
+    static void setHeadless(bool enabled);
+
+    /**
+     * @brief Checks whether headless mode is on
+     * @return true if progress bars are silent and cannot be cancelled
+     */
+    static bool isHeadless();
 };
 
 #endif // PROGRESSBAR_H
\ No newline at end of file
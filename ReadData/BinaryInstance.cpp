@@ -0,0 +1,131 @@
+#include "BinaryInstance.h"
+#include "read.h"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static const char BINARY_INSTANCE_MAGIC[4] = {'K', 'B', 'I', 'N'};
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+static const uint64_t FNV_PRIME = 1099511628211ull;
+
+// columns are stored as-is, which matches the format only on little-endian hosts
+static const bool HOST_IS_LITTLE_ENDIAN = std::endian::native == std::endian::little;
+
+static uint64_t alignUp(uint64_t offset) {
+    return (offset + INSTANCE_ALIGNMENT - 1) / INSTANCE_ALIGNMENT * INSTANCE_ALIGNMENT;
+}
+
+static uint64_t hashColumn(uint64_t hash, const unsigned int column[], unsigned int n) {
+    for (unsigned int i = 0; i < n; i++) {
+        hash = (hash ^ column[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t binaryInstanceChecksum(const InstanceView &instance) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = hashColumn(hash, instance.weights, instance.n);
+    hash = hashColumn(hash, instance.profits, instance.n);
+    hash = hashColumn(hash, instance.pallets, instance.n);
+    return hash;
+}
+
+bool writeBinaryInstance(const InstanceView &instance, const std::string &filename) {
+    if (!HOST_IS_LITTLE_ENDIAN) {
+        std::cerr << "The binary instance format is only supported on little-endian hosts" << std::endl;
+        return false;
+    }
+    if (instance.volumes != nullptr) {
+        std::cerr << "Warning: the binary instance format has no volume column, volumes are not stored" << std::endl;
+    }
+
+    uint64_t columnBytes = static_cast<uint64_t>(instance.n) * sizeof(uint32_t);
+    BinaryInstanceHeader header = {};
+    memcpy(header.magic, BINARY_INSTANCE_MAGIC, sizeof(header.magic));
+    header.version = BINARY_INSTANCE_VERSION;
+    header.n = instance.n;
+    header.capacity = instance.capacity;
+    header.weights_offset = sizeof(BinaryInstanceHeader);
+    header.profits_offset = alignUp(header.weights_offset + columnBytes);
+    header.pallets_offset = alignUp(header.profits_offset + columnBytes);
+    header.checksum = binaryInstanceChecksum(instance);
+    header.max_pallets = instance.max_pallets;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file: " << filename << std::endl;
+        return false;
+    }
+
+    const char padding[INSTANCE_ALIGNMENT] = {};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    const unsigned int *columns[3] = {instance.weights, instance.profits, instance.pallets};
+    for (const unsigned int *column : columns) {
+        file.write(reinterpret_cast<const char *>(column), columnBytes);
+        file.write(padding, alignUp(columnBytes) - columnBytes);
+    }
+
+    if (!file) {
+        std::cerr << "Failed to write file: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool convertCsvToBinary(const std::string &truckFile, const std::string &palletFile, const std::string &filename) {
+    Instance instance;
+    return readInstance(truckFile, palletFile, instance) && writeBinaryInstance(instance.view(), filename);
+}
+
+BinaryInstance::BinaryInstance(const std::string &filename) : file(filename, false), header(nullptr) {
+    if (!file.isOpen()) {
+        problem = "failed to open file";
+        return;
+    }
+    if (!HOST_IS_LITTLE_ENDIAN) {
+        problem = "the binary instance format is only supported on little-endian hosts";
+        return;
+    }
+    if (file.size() < sizeof(BinaryInstanceHeader)) {
+        problem = "file is too small for a header";
+        return;
+    }
+
+    const BinaryInstanceHeader *candidate = reinterpret_cast<const BinaryInstanceHeader *>(file.data());
+    if (memcmp(candidate->magic, BINARY_INSTANCE_MAGIC, sizeof(candidate->magic)) != 0) {
+        problem = "not a binary instance file";
+        return;
+    }
+    if (candidate->version < BINARY_INSTANCE_MIN_VERSION || candidate->version > BINARY_INSTANCE_VERSION) {
+        problem = "unsupported format version " + std::to_string(candidate->version);
+        return;
+    }
+
+    uint64_t columnBytes = static_cast<uint64_t>(candidate->n) * sizeof(uint32_t);
+    uint64_t offsets[3] = {candidate->weights_offset, candidate->profits_offset, candidate->pallets_offset};
+    for (uint64_t offset : offsets) {
+        if (offset % INSTANCE_ALIGNMENT != 0 || offset < sizeof(BinaryInstanceHeader) ||
+            offset > file.size() || file.size() - offset < columnBytes) {
+            problem = "column offsets do not fit the file";
+            return;
+        }
+    }
+
+    header = candidate;
+}
+
+bool BinaryInstance::verifyChecksum() const {
+    return isValid() && binaryInstanceChecksum(view()) == header->checksum;
+}
+
+InstanceView BinaryInstance::view() const {
+    if (!isValid()) {
+        return {nullptr, nullptr, nullptr, 0, 0, nullptr, 0, 0};
+    }
+    const char *base = file.data();
+    return {reinterpret_cast<const unsigned int *>(base + header->pallets_offset),
+            reinterpret_cast<const unsigned int *>(base + header->weights_offset),
+            reinterpret_cast<const unsigned int *>(base + header->profits_offset),
+            header->n, header->capacity, nullptr, 0, header->version >= 2 ? header->max_pallets : 0};
+}
@@ -0,0 +1,134 @@
+/**
+ * @file BinaryInstance.h
+ * @brief Binary columnar instance format (.kbin): converter, writer and memory-mapped loader
+ *
+ * Layout (all integers little-endian):
+ * - a 64-byte header: magic "KBIN", format version, n, capacity, the byte offset of the
+ *   weight, profit and ID columns, a checksum of the three columns and the pallet limit;
+ * - the weight, profit and pallet ID columns, n uint32 each, every column starting on a
+ *   64-byte boundary (zero padding in between).
+ */
+
+#ifndef BINARYINSTANCE_H
+#define BINARYINSTANCE_H
+
+#include <cstdint>
+#include <string>
+#include "Instance.h"
+#include "MappedFile.h"
+
+/// Current .kbin format version (2 added the pallet limit)
+constexpr uint32_t BINARY_INSTANCE_VERSION = 2;
+
+/// Oldest .kbin format version still loaded; version 1 files have no pallet limit
+constexpr uint32_t BINARY_INSTANCE_MIN_VERSION = 1;
+
+/// File extension used for binary instances
+constexpr const char *BINARY_INSTANCE_EXTENSION = ".kbin";
+
+/**
+ * @brief On-disk header of a .kbin file
+ * @var BinaryInstanceHeader::magic "KBIN"
+ * @var BinaryInstanceHeader::version Format version (BINARY_INSTANCE_VERSION)
+ * @var BinaryInstanceHeader::n Number of pallets
+ * @var BinaryInstanceHeader::capacity Truck's maximum weight capacity
+ * @var BinaryInstanceHeader::weights_offset Byte offset of the weight column
+ * @var BinaryInstanceHeader::profits_offset Byte offset of the profit column
+ * @var BinaryInstanceHeader::pallets_offset Byte offset of the pallet ID column
+ * @var BinaryInstanceHeader::checksum Checksum of the three columns (see binaryInstanceChecksum)
+ * @var BinaryInstanceHeader::max_pallets Maximum number of pallets on the truck, 0 for no limit
+ *      (version 2 on; reserved and zero in version 1)
+ */
+struct BinaryInstanceHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t n;
+    uint32_t capacity;
+    uint64_t weights_offset;
+    uint64_t profits_offset;
+    uint64_t pallets_offset;
+    uint64_t checksum;
+    uint32_t max_pallets;
+    unsigned char reserved[12];
+};
+
+static_assert(sizeof(BinaryInstanceHeader) == INSTANCE_ALIGNMENT, "the header fills exactly one aligned block");
+
+/**
+ * @brief Checksum stored in the header: 64-bit FNV-1a over the weight, profit and ID words
+ * @param instance Instance to hash
+ * @return The checksum
+ * @note Time Complexity: O(n)
+ */
+uint64_t binaryInstanceChecksum(const InstanceView &instance);
+
+/**
+ * @brief Writes an instance in the .kbin format
+ * @param instance Instance to store
+ * @param filename Output path
+ * @return true on success, false if the file could not be written
+ */
+bool writeBinaryInstance(const InstanceView &instance, const std::string &filename);
+
+/**
+ * @brief Converts a TruckAndPallets/Pallets CSV pair into a .kbin file
+ * @param truckFile CSV with the truck capacity and pallet count
+ * @param palletFile CSV with the pallets
+ * @param filename Output path
+ * @return true on success, false if readInstance fails on the CSVs or the output is not written
+ * @note The pallet limit of the truck CSV is stored; volumes are not (see writeBinaryInstance)
+ */
+bool convertCsvToBinary(const std::string &truckFile, const std::string &palletFile, const std::string &filename);
+
+/**
+ * @brief A .kbin file mapped read-only into memory, whose columns are used in place
+ *
+ * Opening only maps the file and validates the header (magic, version, column offsets,
+ * alignment and sizes against the file length), so the load cost does not depend on n.
+ * The checksum is checked separately by verifyChecksum().
+ *
+ * @var BinaryInstance::file The mapping; the views handed out point into it
+ * @var BinaryInstance::header Header at the start of the mapping, nullptr if invalid
+ * @var BinaryInstance::problem Description of why the file was rejected, empty if valid
+ */
+class BinaryInstance {
+private:
+    MappedFile file;
+    const BinaryInstanceHeader *header;
+    std::string problem;
+
+public:
+    /**
+     * @brief Maps a .kbin file and validates its header
+     * @param filename Path to the file
+     * @note Time Complexity: O(1) (apart from the page faults on first access of the columns)
+     */
+    explicit BinaryInstance(const std::string &filename);
+
+    /**
+     * @brief Checks whether the file was mapped and its header is valid
+     * @return true if view() can be used
+     */
+    bool isValid() const { return header != nullptr; }
+
+    /**
+     * @brief Reason the file was rejected
+     * @return Error message, empty for a valid file
+     */
+    const std::string &error() const { return problem; }
+
+    /**
+     * @brief Recomputes the column checksum and compares it to the header
+     * @return true if they match
+     * @note Time Complexity: O(n)
+     */
+    bool verifyChecksum() const;
+
+    /**
+     * @brief Read-only view of the mapped columns, valid while this object lives
+     * @return View of the instance
+     */
+    InstanceView view() const;
+};
+
+#endif // BINARYINSTANCE_H
@@ -0,0 +1,301 @@
+#include "FastRead.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+enum class FieldStatus { Ok, Invalid, OutOfRange };
+
+// position of the next ',' or '\n' in [p, end), or end
+static const char *nextDelimiterScalar(const char *p, const char *end) {
+    while (p < end && *p != ',' && *p != '\n') {
+        ++p;
+    }
+    return p;
+}
+
+#if defined(__SSE2__)
+static const char *nextDelimiterSimd(const char *p, const char *end) {
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (p + 16 <= end) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, comma),
+                                                  _mm_cmpeq_epi8(block, newline)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+    return nextDelimiterScalar(p, end);
+}
+
+static size_t countNewlinesSimd(const char *p, const char *end) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    size_t count = 0;
+    while (p + 16 <= end) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+        p += 16;
+    }
+    for (; p < end; ++p) {
+        count += (*p == '\n');
+    }
+    return count;
+}
+#endif
+
+static const char *nextDelimiter(const char *p, const char *end, bool useSimd) {
+#if defined(__SSE2__)
+    if (useSimd) {
+        return nextDelimiterSimd(p, end);
+    }
+#endif
+    (void)useSimd;
+    return nextDelimiterScalar(p, end);
+}
+
+static size_t countNewlines(const char *p, const char *end, bool useSimd) {
+#if defined(__SSE2__)
+    if (useSimd) {
+        return countNewlinesSimd(p, end);
+    }
+#endif
+    (void)useSimd;
+    size_t count = 0;
+    for (const char *q = static_cast<const char *>(memchr(p, '\n', end - p)); q != nullptr;
+         q = static_cast<const char *>(memchr(q + 1, '\n', end - q - 1))) {
+        ++count;
+    }
+    return count;
+}
+
+static bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// parses an unsigned integer filling the whole field, ignoring surrounding blanks
+static FieldStatus parseField(const char *begin, const char *end, unsigned int &value) {
+    while (begin < end && isBlank(*begin)) {
+        ++begin;
+    }
+    while (end > begin && isBlank(end[-1])) {
+        --end;
+    }
+    if (begin == end) {
+        return FieldStatus::Invalid;
+    }
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    if (ec == std::errc::result_out_of_range) {
+        return FieldStatus::OutOfRange;
+    }
+    if (ec != std::errc() || ptr != end) {
+        return FieldStatus::Invalid;
+    }
+    return FieldStatus::Ok;
+}
+
+// parses the pallet rows in [p, end) into the given column slices, reporting bad rows on errors;
+// a fourth (volume) column is required when volumes is not null; returns the number of rows written
+static size_t parsePalletRows(const char *p, const char *end, unsigned int *pallets, unsigned int *weights,
+                              unsigned int *profits, unsigned int *volumes, std::ostream &errors, bool useSimd) {
+    const int fields = volumes != nullptr ? 4 : 3;
+    size_t rows = 0;
+    while (p < end) {
+        const char *lineEnd = static_cast<const char *>(memchr(p, '\n', end - p));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+
+        const char *fieldStart = p;
+        unsigned int values[4];
+        FieldStatus status = FieldStatus::Ok;
+        bool blankLine = true;
+        for (int field = 0; field < fields && status == FieldStatus::Ok; ++field) {
+            const char *fieldEnd = nextDelimiter(fieldStart, lineEnd, useSimd);
+            for (const char *c = fieldStart; c < fieldEnd && blankLine; ++c) {
+                blankLine = isBlank(*c);
+            }
+            status = parseField(fieldStart, fieldEnd, values[field]);
+            if (field < fields - 1 && fieldEnd == lineEnd && status == FieldStatus::Ok) {
+                status = FieldStatus::Invalid; // missing columns
+            }
+            fieldStart = fieldEnd + 1;
+        }
+
+        if (status == FieldStatus::Ok) {
+            pallets[rows] = values[0];
+            weights[rows] = values[1];
+            profits[rows] = values[2];
+            if (volumes != nullptr) {
+                volumes[rows] = values[3];
+            }
+            ++rows;
+        }
+        else if (!blankLine) {
+            std::string_view line(p, lineEnd - p);
+            if (status == FieldStatus::OutOfRange) {
+                errors << "Data out of range in line: " << line << std::endl;
+            }
+            else {
+                errors << "Invalid data in line: " << line << std::endl;
+            }
+        }
+
+        p = lineEnd + 1;
+    }
+    return rows;
+}
+
+// first byte after the header line, or nullptr if there is no row after it
+static const char *skipHeader(const char *begin, const char *end) {
+    const char *header = begin == end ? nullptr : static_cast<const char *>(memchr(begin, '\n', end - begin));
+    return header == nullptr ? nullptr : header + 1;
+}
+
+// true if the fourth column of the header line [begin, end) is named "Volume"
+static bool headerHasVolume(const char *begin, const char *end) {
+    const char *fieldStart = begin;
+    for (int field = 0; field < 3; ++field) {
+        fieldStart = nextDelimiterScalar(fieldStart, end);
+        if (fieldStart == end || *fieldStart != ',') {
+            return false;
+        }
+        ++fieldStart;
+    }
+    const char *fieldEnd = nextDelimiterScalar(fieldStart, end);
+    while (fieldStart < fieldEnd && isBlank(*fieldStart)) {
+        ++fieldStart;
+    }
+    while (fieldEnd > fieldStart && isBlank(fieldEnd[-1])) {
+        --fieldEnd;
+    }
+    return std::string_view(fieldStart, fieldEnd - fieldStart) == "Volume";
+}
+
+// sizes the volume column to match the others, or drops it when the file has none
+static void resizeVolumes(Instance &instance, bool withVolume) {
+    if (withVolume) {
+        instance.volumes.resize(instance.size());
+    }
+    else {
+        instance.volumes.clear();
+    }
+}
+
+bool loadPalletsMapped(const std::string &filename, Instance &instance, bool useSimd) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cerr << "Failed to open file: " << filename << std::endl;
+        return false;
+    }
+
+    const char *end = file.data() + file.size();
+    const char *rows = skipHeader(file.data(), end);
+    if (rows == nullptr) {
+        instance.resize(0);
+        instance.volumes.clear();
+        return true;
+    }
+    bool withVolume = headerHasVolume(file.data(), rows);
+
+    // one row per line at most: size once, no reallocation while parsing
+    instance.resize(countNewlines(rows, end, useSimd) + 1);
+    resizeVolumes(instance, withVolume);
+    size_t parsed = parsePalletRows(rows, end, instance.pallets.data(), instance.weights.data(),
+                                    instance.profits.data(), withVolume ? instance.volumes.data() : nullptr,
+                                    std::cerr, useSimd);
+    instance.resize(parsed);
+    resizeVolumes(instance, withVolume);
+    return true;
+}
+
+bool loadPalletsParallel(const std::string &filename, Instance &instance, unsigned int threads, bool useSimd) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cerr << "Failed to open file: " << filename << std::endl;
+        return false;
+    }
+
+    const char *end = file.data() + file.size();
+    const char *rows = skipHeader(file.data(), end);
+    if (rows == nullptr) {
+        instance.resize(0);
+        instance.volumes.clear();
+        return true;
+    }
+    bool withVolume = headerHasVolume(file.data(), rows);
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t bytes = end - rows;
+    size_t chunkCount = std::max<size_t>(1, std::min<size_t>(threads, bytes / PARALLEL_READ_MIN_CHUNK));
+
+    // chunk boundaries, each moved forward to the start of a line
+    std::vector<const char *> bounds(chunkCount + 1, end);
+    bounds[0] = rows;
+    for (size_t c = 1; c < chunkCount; ++c) {
+        const char *guess = std::max(rows + bytes / chunkCount * c, bounds[c - 1]);
+        const char *newline = static_cast<const char *>(memchr(guess, '\n', end - guess));
+        bounds[c] = newline == nullptr ? end : newline + 1;
+    }
+
+    auto forEachChunk = [&](auto &&work) {
+        std::vector<std::thread> workers;
+        for (size_t c = 1; c < chunkCount; ++c) {
+            workers.emplace_back(work, c);
+        }
+        work(0);
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    };
+
+    // pass 1: line count per chunk, prefix-summed into each chunk's first output row
+    std::vector<size_t> offsets(chunkCount + 1, 0);
+    forEachChunk([&](size_t c) { offsets[c + 1] = countNewlines(bounds[c], bounds[c + 1], useSimd) + 1; });
+    for (size_t c = 0; c < chunkCount; ++c) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    // pass 2: every chunk parses straight into its own slice of the final columns
+    instance.resize(offsets[chunkCount]);
+    resizeVolumes(instance, withVolume);
+    std::vector<size_t> parsed(chunkCount, 0);
+    std::vector<std::ostringstream> errors(chunkCount);
+    forEachChunk([&](size_t c) {
+        parsed[c] = parsePalletRows(bounds[c], bounds[c + 1], instance.pallets.data() + offsets[c],
+                                    instance.weights.data() + offsets[c], instance.profits.data() + offsets[c],
+                                    withVolume ? instance.volumes.data() + offsets[c] : nullptr, errors[c], useSimd);
+    });
+
+    // close the gaps left by blank or rejected lines, keeping file order
+    size_t total = parsed[0];
+    for (size_t c = 1; c < chunkCount; ++c) {
+        if (total != offsets[c]) {
+            std::copy_n(instance.pallets.begin() + offsets[c], parsed[c], instance.pallets.begin() + total);
+            std::copy_n(instance.weights.begin() + offsets[c], parsed[c], instance.weights.begin() + total);
+            std::copy_n(instance.profits.begin() + offsets[c], parsed[c], instance.profits.begin() + total);
+            if (withVolume) {
+                std::copy_n(instance.volumes.begin() + offsets[c], parsed[c], instance.volumes.begin() + total);
+            }
+        }
+        total += parsed[c];
+    }
+    instance.resize(total);
+    resizeVolumes(instance, withVolume);
+
+    for (const std::ostringstream &chunkErrors : errors) {
+        std::cerr << chunkErrors.str();
+    }
+    return true;
+}
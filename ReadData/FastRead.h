@@ -0,0 +1,52 @@
+/**
+ * @file FastRead.h
+ * @brief Zero-copy pallet CSV loader based on mmap and std::from_chars
+ */
+
+#ifndef FASTREAD_H
+#define FASTREAD_H
+
+#include <cstddef>
+#include <string>
+#include "Instance.h"
+
+/// Minimum number of bytes per thread for loadPalletsParallel; smaller files are parsed by fewer threads
+constexpr size_t PARALLEL_READ_MIN_CHUNK = 1 << 20;
+
+/**
+ * @brief Loads a pallet CSV by memory-mapping it and parsing the fields in place
+ * @param filename Path to the CSV file containing pallet data
+ * @param instance Output instance; its pallets are replaced, the capacity is left untouched
+ * @param useSimd If true, scan for commas and newlines 16 bytes at a time with SSE2 (when available)
+ * @return true if the file could be opened, false otherwise
+ *
+ * @note Same format as readPallets: a header row, then pallet ID, weight and profit separated
+ *       by commas, with optional spaces around the fields. Blank lines are skipped; rows with
+ *       invalid or out-of-range numbers are reported on stderr and skipped.
+ * @note When the fourth header column is named "Volume", it is read as the pallet volume and
+ *       every row must have it; otherwise (no fourth column, or any other name) extra columns
+ *       are ignored and the volume column of the instance is left empty.
+ * @note The newlines are counted first so the columns are sized once: there is no per-row
+ *       heap allocation and no copy of the file contents.
+ */
+bool loadPalletsMapped(const std::string &filename, Instance &instance, bool useSimd = true);
+
+/**
+ * @brief Loads a pallet CSV like loadPalletsMapped, splitting the rows across several threads
+ * @param filename Path to the CSV file containing pallet data
+ * @param instance Output instance; its pallets are replaced, the capacity is left untouched
+ * @param threads Number of threads (0 = hardware concurrency)
+ * @param useSimd If true, scan for commas and newlines 16 bytes at a time with SSE2 (when available)
+ * @return true if the file could be opened, false otherwise
+ *
+ * @note The mapped rows are split into one chunk per thread, each boundary moved to the start of
+ *       a line. A first parallel pass counts the lines of every chunk; the prefix sum of those
+ *       counts gives each chunk its own slice of the instance columns, which a second parallel pass
+ *       fills directly. Rows are only moved afterwards when blank or invalid lines left gaps.
+ * @note Rows keep their file order, and bad rows are reported in file order once all chunks are done.
+ * @note Time Complexity: O(B / T) for B bytes and T threads
+ */
+bool loadPalletsParallel(const std::string &filename, Instance &instance, unsigned int threads = 0,
+                         bool useSimd = true);
+
+#endif // FASTREAD_H
@@ -0,0 +1,163 @@
+/**
+ * @file Instance.h
+ * @brief Self-sizing container for one truck packing instance
+ */
+
+#ifndef INSTANCE_H
+#define INSTANCE_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/// Alignment of the pallet columns in bytes (one cache line, also enough for AVX-512 loads)
+constexpr size_t INSTANCE_ALIGNMENT = 64;
+
+/**
+ * @brief Minimal allocator returning memory aligned to Align bytes
+ * @tparam T Element type
+ * @tparam Align Alignment in bytes (power of two)
+ */
+template <typename T, size_t Align = INSTANCE_ALIGNMENT>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Align>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align> &) {}
+
+    T *allocate(size_t count) {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T *pointer, size_t) {
+        ::operator delete(pointer, std::align_val_t(Align));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Align> &) const { return true; }
+};
+
+/// Vector whose data() is aligned to INSTANCE_ALIGNMENT bytes
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+/**
+ * @brief Read-only view of an instance, as taken by the solvers
+ * @var InstanceView::pallets Pallet IDs
+ * @var InstanceView::weights Pallet weights
+ * @var InstanceView::profits Pallet profit values
+ * @var InstanceView::n Number of pallets
+ * @var InstanceView::capacity Truck's maximum weight capacity
+ * @var InstanceView::volumes Pallet volumes, nullptr when the instance has no volume column
+ * @var InstanceView::volume_capacity Truck's maximum volume (only meaningful with volumes)
+ * @var InstanceView::max_pallets Maximum number of pallets on the truck, 0 for no limit
+ */
+struct InstanceView {
+    const unsigned int *pallets;
+    const unsigned int *weights;
+    const unsigned int *profits;
+    unsigned int n;
+    unsigned int capacity;
+    const unsigned int *volumes;
+    unsigned int volume_capacity;
+    unsigned int max_pallets;
+};
+
+/**
+ * @brief Truck capacity plus the pallets in structure-of-arrays layout
+ * @var Instance::capacity Truck's maximum weight capacity
+ * @var Instance::pallets Pallet IDs
+ * @var Instance::weights Pallet weights
+ * @var Instance::profits Pallet profit values
+ * @var Instance::volume_capacity Truck's maximum volume (only meaningful with volumes)
+ * @var Instance::volumes Pallet volumes; empty when the input has no volume column
+ * @var Instance::max_pallets Maximum number of pallets on the truck (forklift slots), 0 for no limit
+ *
+ * @note The columns grow as rows are appended, so the pallet count never has to be known in
+ *       advance; loaders reserve from an estimate of the row count to avoid reallocating.
+ * @note reserve(), resize() and the three-value push_back() only touch the weight-based
+ *       columns; loaders that read volumes fill the volume column themselves.
+ */
+struct Instance {
+    unsigned int capacity = 0;
+    AlignedVector<unsigned int> pallets;
+    AlignedVector<unsigned int> weights;
+    AlignedVector<unsigned int> profits;
+    unsigned int volume_capacity = 0;
+    AlignedVector<unsigned int> volumes;
+    unsigned int max_pallets = 0;
+
+    /**
+     * @brief Checks whether every pallet has a volume
+     * @return true if the volume column is filled in
+     */
+    bool hasVolumes() const { return !pallets.empty() && volumes.size() == pallets.size(); }
+
+    /**
+     * @brief Number of pallets in the instance
+     * @return Number of rows in the columns
+     */
+    unsigned int size() const { return pallets.size(); }
+
+    /**
+     * @brief Reserves room for a number of pallets in every column
+     * @param rows Expected number of pallets
+     */
+    void reserve(size_t rows) {
+        pallets.reserve(rows);
+        weights.reserve(rows);
+        profits.reserve(rows);
+    }
+
+    /**
+     * @brief Sets the number of pallets in every column
+     * @param rows New number of pallets; new rows are zero
+     */
+    void resize(size_t rows) {
+        pallets.resize(rows);
+        weights.resize(rows);
+        profits.resize(rows);
+    }
+
+    /**
+     * @brief Appends one pallet
+     * @param pallet Pallet ID
+     * @param weight Pallet weight
+     * @param profit Pallet profit value
+     */
+    void push_back(unsigned int pallet, unsigned int weight, unsigned int profit) {
+        pallets.push_back(pallet);
+        weights.push_back(weight);
+        profits.push_back(profit);
+    }
+
+    /**
+     * @brief Appends one pallet with its volume
+     * @param pallet Pallet ID
+     * @param weight Pallet weight
+     * @param profit Pallet profit value
+     * @param volume Pallet volume
+     */
+    void push_back(unsigned int pallet, unsigned int weight, unsigned int profit, unsigned int volume) {
+        push_back(pallet, weight, profit);
+        volumes.push_back(volume);
+    }
+
+    /**
+     * @brief Read-only pointers to the columns, valid until the instance is modified
+     * @return View of the instance
+     */
+    InstanceView view() const {
+        return {pallets.data(), weights.data(), profits.data(), size(), capacity,
+                hasVolumes() ? volumes.data() : nullptr, volume_capacity, max_pallets};
+    }
+};
+
+#endif // INSTANCE_H
@@ -0,0 +1,42 @@
+#include "MappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &filename, bool sequential) : bytes(nullptr), length(0), opened(false) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return;
+    }
+
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0) {
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            length = 0;
+            return;
+        }
+        if (sequential) {
+            madvise(mapping, length, MADV_SEQUENTIAL);
+        }
+        bytes = static_cast<const char *>(mapping);
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+    if (bytes != nullptr) {
+        munmap(const_cast<char *>(bytes), length);
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory mapping of a whole file
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief RAII wrapper around a read-only, private mmap of a file
+ * @var MappedFile::bytes Start of the mapping (nullptr for an empty or unopened file)
+ * @var MappedFile::length Size of the file in bytes
+ * @var MappedFile::opened Whether the file could be opened and mapped
+ */
+class MappedFile
+{
+private:
+    const char *bytes;
+    size_t length;
+    bool opened;
+
+public:
+    /**
+     * @brief Maps the whole file into memory
+     * @param filename Path to the file
+     * @param sequential If true, advise the kernel that the file is read front to back once
+     * @note Check isOpen() afterwards; an empty file is open with size() == 0
+     */
+    explicit MappedFile(const std::string &filename, bool sequential = true);
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Checks whether the file was opened and mapped
+     * @return true on success
+     */
+    bool isOpen() const { return opened; }
+
+    /**
+     * @brief First byte of the file
+     * @return Pointer to the mapped bytes
+     */
+    const char *data() const { return bytes; }
+
+    /**
+     * @brief Size of the file
+     * @return Number of mapped bytes
+     */
+    size_t size() const { return length; }
+};
+
+#endif // MAPPEDFILE_H
@@ -1,33 +1,64 @@
 #include "read.h"
+#include "FastRead.h"
+#include <algorithm>
+#include <filesystem>
 
-void readPallets(const std::string &filename,unsigned int pallets[], unsigned int weights[], unsigned int profits[]) {
+// splits a CSV line into its fields, without surrounding blanks
+static std::vector<std::string> splitFields(const std::string &line) {
+    std::vector<std::string> fields;
+    std::stringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, ',')) {
+        size_t first = field.find_first_not_of(" \t\r");
+        size_t last = field.find_last_not_of(" \t\r");
+        fields.push_back(first == std::string::npos ? "" : field.substr(first, last - first + 1));
+    }
+    return fields;
+}
+
+bool readPallets(const std::string &filename, Instance &instance) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Failed to open file: " << filename << std::endl;
-        return;
+        return false;
+    }
+
+    // reserve from the file size, the columns still grow if the estimate is short
+    std::error_code error;
+    std::uintmax_t bytes = std::filesystem::file_size(filename, error);
+    if (!error) {
+        instance.reserve(instance.size() + bytes / PALLET_ROW_BYTES_ESTIMATE);
     }
 
     std::string line;
-    // skip the header line
+    // skip the header line, a fourth column named "Volume" in it means the pallets have a volume
     std::getline(file, line);
-
-    unsigned int index = 0;
+    std::vector<std::string> header = splitFields(line);
+    bool withVolume = header.size() >= 4 && header[3] == "Volume";
+    if (withVolume && !instance.hasVolumes()) {
+        instance.volumes.assign(instance.size(), 0);
+    }
 
     while (std::getline(file, line)) {
 
       	try {
         std::stringstream ss(line);
-        std::string pallet, weight, profit;
+        std::string pallet, weight, profit, volume;
 
         std::getline(ss, pallet, ',');
         std::getline(ss, weight, ',');
         std::getline(ss, profit, ',');
 
-        pallets[index] = std::stoi(pallet);
-        weights[index] = std::stoi(weight);
-        profits[index] = std::stoi(profit);
-
-        ++index;
+        unsigned int palletId = std::stoi(pallet);
+        unsigned int palletWeight = std::stoi(weight);
+        unsigned int palletProfit = std::stoi(profit);
+        if (withVolume) {
+            std::getline(ss, volume, ',');
+            instance.push_back(palletId, palletWeight, palletProfit, std::stoi(volume));
+        }
+        else {
+            instance.push_back(palletId, palletWeight, palletProfit);
+        }
         }
         catch (const std::invalid_argument &e) {
             std::cerr << "Invalid data in line: " << line << std::endl;
@@ -40,31 +71,98 @@ void readPallets(const std::string &filename,unsigned int pallets[], unsigned in
     }
 
     file.close();
-    return;
+    return true;
 }
 
-void readTrucks(const std::string &filename, unsigned int *trucksAndPallets) {
+bool readTrucks(const std::string &filename, unsigned int *trucksAndPallets, unsigned int *volumeCapacity,
+                unsigned int *maxPallets) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Failed to open file: " << filename << std::endl;
-        return;
+        return false;
     }
 
     std::string line;
-    // skip the header line
+    // the header line names the optional columns
     std::getline(file, line);
+    std::vector<std::string> header = splitFields(line);
+    size_t volumeColumn = std::find(header.begin(), header.end(), "Volume") - header.begin();
+    size_t maxPalletsColumn = std::find(header.begin(), header.end(), "MaxPallets") - header.begin();
 
     while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string capacity, pallets;
-
-        std::getline(ss, capacity, ',');
-        std::getline(ss, pallets, ',');
+        std::vector<std::string> fields = splitFields(line);
+        if (fields.size() < 2) {
+            continue;
+        }
 
-        trucksAndPallets[0] = std::stoi(capacity);
-        trucksAndPallets[1] = std::stoi(pallets);
+        trucksAndPallets[0] = std::stoi(fields[0]);
+        trucksAndPallets[1] = std::stoi(fields[1]);
+        if (volumeCapacity != nullptr) {
+            *volumeCapacity = volumeColumn < fields.size() ? std::stoi(fields[volumeColumn]) : 0;
+        }
+        if (maxPallets != nullptr) {
+            *maxPallets = maxPalletsColumn < fields.size() ? std::stoi(fields[maxPalletsColumn]) : 0;
+        }
     }
 
     file.close();
-    return;
-}
\ No newline at end of file
+    return true;
+}
+
+bool readInstance(const std::string &truckFile, const std::string &palletFile, Instance &instance) {
+    unsigned int trucksAndPallets[2] = {0, 0};
+    try {
+        if (!readTrucks(truckFile, trucksAndPallets, &instance.volume_capacity, &instance.max_pallets)) {
+            return false;
+        }
+    } catch (const std::exception &) {
+        std::cerr << "Invalid truck data in file: " << truckFile << std::endl;
+        return false;
+    }
+
+    instance.capacity = trucksAndPallets[0];
+    if (!loadPalletsParallel(palletFile, instance)) {
+        return false;
+    }
+    if (instance.size() != trucksAndPallets[1]) {
+        std::cerr << "Warning: " << truckFile << " declares " << trucksAndPallets[1] << " pallets but "
+                  << instance.size() << " were read from " << palletFile << std::endl;
+    }
+    return true;
+}
+
+bool readFleet(const std::string &filename, std::vector<unsigned int> &capacities) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file: " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    // skip the header line
+    std::getline(file, line);
+
+    while (std::getline(file, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        try {
+            std::stringstream ss(line);
+            std::string capacity;
+            std::getline(ss, capacity, ',');
+            long long value = std::stoll(capacity);
+            if (value < 0 || value > UINT_MAX) {
+                throw std::out_of_range("capacity");
+            }
+            capacities.push_back(static_cast<unsigned int>(value));
+        }
+        catch (const std::invalid_argument &e) {
+            std::cerr << "Invalid data in line: " << line << std::endl;
+        }
+        catch (const std::out_of_range &e) {
+            std::cerr << "Data out of range in line: " << line << std::endl;
+        }
+    }
+
+    return true;
+}
@@ -11,29 +11,69 @@
 #include <fstream>
 #include <climits>
 #include <sstream>
+#include "Instance.h"
+
+/// Bytes per pallet row assumed when reserving from the file size (e.g. "123,45,678\n" is 11)
+constexpr size_t PALLET_ROW_BYTES_ESTIMATE = 12;
 
 /**
  * @brief Reads pallet data from a CSV file
  *
  * @param filename Path to the CSV file containing pallet data
- * @param pallets Array to store pallet IDs
- * @param weights Array to store pallet weights
- * @param profits Array to store pallet profit values
+ * @param instance Instance the pallets are appended to; it grows as rows are read
+ * @return true if the file could be opened, false otherwise
  *
  * @note The CSV file should have a header row and columns for pallet ID, weight, and profit,
  *       separated by commas. The function skips the header row.
+ * @note A fourth header column named "Volume" is read as the pallet volume, which every row must
+ *       then have; a fourth column with any other name is ignored.
+ * @note The columns are reserved from the file size divided by PALLET_ROW_BYTES_ESTIMATE, so
+ *       the pallet count does not have to be known beforehand. Invalid rows are skipped
+ *       without leaving gaps.
  */
-void readPallets(const std::string &filename, unsigned int pallets[], unsigned int weights[], unsigned int profits[]);
+bool readPallets(const std::string &filename, Instance &instance);
 
 /**
  * @brief Reads truck capacity and pallet count data from a CSV file
  *
  * @param filename Path to the CSV file containing truck data
  * @param trucksAndPallets Array to store the truck capacity [0] and pallet count [1]
+ * @param volumeCapacity If not null, receives the truck volume from an optional "Volume" column
+ *                       (0 when the file has none)
+ * @param maxPallets If not null, receives the pallet limit from an optional "MaxPallets" column
+ *                   (0, no limit, when the file has none)
+ *
+ * @return true if the file could be opened, false otherwise
  *
  * @note The CSV file should have a header row and columns for truck capacity and number of pallets,
- *       separated by commas. The function skips the header row.
+ *       separated by commas. Optional columns after those two are found by their header name.
+ */
+bool readTrucks(const std::string &filename, unsigned int *trucksAndPallets, unsigned int *volumeCapacity = nullptr,
+                unsigned int *maxPallets = nullptr);
+
+/**
+ * @brief Reads a TruckAndPallets / Pallets CSV pair into one instance
+ *
+ * @param truckFile Path to the TruckAndPallets CSV (capacity, pallet count and optional columns)
+ * @param palletFile Path to the Pallets CSV
+ * @param instance Output instance; its pallets are replaced
+ * @return true if both files could be opened and read, false otherwise
+ *
+ * @note The pallets are loaded with loadPalletsParallel. A pallet count that does not match the
+ *       truck file is reported on stderr but is not an error; malformed numbers in the truck file are.
+ */
+bool readInstance(const std::string &truckFile, const std::string &palletFile, Instance &instance);
+
+/**
+ * @brief Reads the capacities of a fleet of trucks from a CSV file
+ *
+ * @param filename Path to the CSV file, in the TruckAndPallets format with one row per truck
+ * @param capacities Vector the truck capacities are appended to, in file order
+ * @return true if the file could be opened, false otherwise
+ *
+ * @note Only the first column (capacity) is used. Blank lines are skipped; invalid rows are
+ *       reported and skipped.
  */
-void readTrucks(const std::string &filename, unsigned int *trucksAndPallets);
+bool readFleet(const std::string &filename, std::vector<unsigned int> &capacities);
 
 #endif // READ_H
\ No newline at end of file
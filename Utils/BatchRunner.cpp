@@ -0,0 +1,173 @@
+#include "BatchRunner.h"
+#include "../Output/Output.h"
+#include "../ReadData/read.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// exit codes of a batch child, on top of the ones runIsolatedJob reserves
+static const int BATCH_JOB_OK = 0;
+static const int BATCH_JOB_SKIPPED = 1;
+static const int BATCH_JOB_INPUT_ERROR = 2;
+
+static const std::string TRUCK_PREFIX = "TruckAndPallets_";
+static const std::string PALLET_PREFIX = "Pallets_";
+static const std::string CSV_SUFFIX = ".csv";
+
+std::vector<BatchEntry> scanBatchDirectory(const std::string &directory)
+{
+    namespace fs = std::filesystem;
+    std::vector<BatchEntry> entries;
+    std::error_code error;
+    for (const fs::directory_entry &file : fs::directory_iterator(directory, error))
+    {
+        std::string filename = file.path().filename().string();
+        if (filename.size() <= PALLET_PREFIX.size() + CSV_SUFFIX.size() ||
+            filename.compare(0, PALLET_PREFIX.size(), PALLET_PREFIX) != 0 ||
+            filename.compare(filename.size() - CSV_SUFFIX.size(), CSV_SUFFIX.size(), CSV_SUFFIX) != 0)
+            continue;
+
+        std::string name = filename.substr(PALLET_PREFIX.size(),
+                                           filename.size() - PALLET_PREFIX.size() - CSV_SUFFIX.size());
+        fs::path truck = file.path().parent_path() / (TRUCK_PREFIX + name + CSV_SUFFIX);
+        if (!fs::exists(truck))
+        {
+            std::cerr << "Skipping " << file.path().string() << ": no " << truck.filename().string() << std::endl;
+            continue;
+        }
+
+        std::error_code sizeError;
+        std::uintmax_t bytes = fs::file_size(file.path(), sizeError);
+        entries.push_back({name, truck.string(), file.path().string(), sizeError ? 0 : bytes});
+    }
+    if (error)
+        std::cerr << "Failed to read directory: " << directory << std::endl;
+
+    std::sort(entries.begin(), entries.end(),
+              [](const BatchEntry &a, const BatchEntry &b) { return a.name < b.name; });
+    return entries;
+}
+
+static std::string formatMs(double ms)
+{
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(3) << ms;
+    return text.str();
+}
+
+// line for an instance whose child did not produce one
+static std::string failureLine(const BatchEntry &entry, const std::string &status, double elapsedMs, bool json)
+{
+    if (json)
+        return "{\"instance\":" + jsonQuote(entry.name) + ",\"status\":" + jsonQuote(status) +
+               ",\"time_ms\":" + formatMs(elapsedMs) + "}\n";
+    return entry.name + "  " + status + "  " + formatMs(elapsedMs) + " ms\n";
+}
+
+// runs in the child: loads the instance, runs the solvers and writes the result line
+static int solveEntry(const BatchEntry &entry, const BatchOptions &options, std::string &line)
+{
+    auto start = std::chrono::steady_clock::now();
+    Instance loaded;
+    if (!readInstance(entry.truck_file, entry.pallet_file, loaded))
+    {
+        line = failureLine(entry, "input-error", 0.0, options.json);
+        return BATCH_JOB_INPUT_ERROR;
+    }
+    InstanceView instance = loaded.view();
+
+    std::vector<SolverResult> results;
+    bool skipped = false;
+    for (const std::string &name : options.solvers)
+    {
+        results.push_back(runSolverCached(options.cache, *findSolver(name), instance, options.solver_options));
+        skipped = skipped || !results.back().ran;
+    }
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const char *status = skipped ? "skipped" : "ok";
+
+    std::ostringstream out;
+    if (options.json)
+    {
+        out << "{\"instance\":" << jsonQuote(entry.name) << ",\"status\":\"" << status << "\""
+            << ",\"n\":" << instance.n << ",\"capacity\":" << instance.capacity
+            << ",\"time_ms\":" << formatMs(elapsedMs) << ",\"results\":[";
+        for (size_t k = 0; k < results.size(); k++)
+        {
+            out << (k == 0 ? "" : ",");
+            OutputSolverResultJson(out, instance, results[k]);
+        }
+        out << "]}\n";
+    }
+    else
+    {
+        out << entry.name << "  " << status << "  n=" << instance.n << " capacity=" << instance.capacity;
+        for (const SolverResult &result : results)
+        {
+            out << "  " << result.solver << ":";
+            if (result.ran)
+                out << result.total_profit << (result.optimal ? "*" : "") << " " << formatMs(result.elapsed_ms) << "ms";
+            else
+                out << "skipped";
+        }
+        out << "  " << formatMs(elapsedMs) << " ms\n";
+    }
+    line = out.str();
+    return skipped ? BATCH_JOB_SKIPPED : BATCH_JOB_OK;
+}
+
+BatchSummary runBatch(const std::vector<BatchEntry> &entries, const BatchOptions &options, std::ostream &out)
+{
+    auto start = std::chrono::steady_clock::now();
+    BatchSummary summary;
+    summary.instances = entries.size();
+
+    // largest first: the longest jobs start early instead of trailing at the end
+    std::vector<unsigned int> order(entries.size());
+    for (unsigned int k = 0; k < order.size(); k++)
+        order[k] = k;
+    std::stable_sort(order.begin(), order.end(),
+                     [&entries](unsigned int a, unsigned int b) { return entries[a].bytes > entries[b].bytes; });
+
+    unsigned int jobs = options.jobs == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.jobs;
+    std::atomic<unsigned int> next(0);
+    std::mutex outputMutex;
+
+    auto worker = [&]()
+    {
+        for (unsigned int k = next++; k < order.size(); k = next++)
+        {
+            const BatchEntry &entry = entries[order[k]];
+            JobOutcome outcome = runIsolatedJob([&entry, &options](std::string &line)
+                                                { return solveEntry(entry, options, line); },
+                                                options.limits);
+
+            std::string line = outcome.status == JobStatus::Finished
+                                   ? outcome.output
+                                   : failureLine(entry, jobStatusName(outcome.status), outcome.elapsed_ms, options.json);
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            if (outcome.status != JobStatus::Finished || outcome.exit_code == BATCH_JOB_INPUT_ERROR)
+                summary.failed++;
+            else if (outcome.exit_code == BATCH_JOB_SKIPPED)
+                summary.skipped++;
+            out << line << std::flush;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned int i = 1; i < std::min<size_t>(jobs, order.size()); i++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &thread : pool)
+        thread.join();
+
+    summary.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
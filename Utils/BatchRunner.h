@@ -0,0 +1,90 @@
+/**
+ * @file BatchRunner.h
+ * @brief Solves every instance of a dataset directory over a pool of isolated worker processes
+ */
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "IsolatedJob.h"
+#include "SolutionCache.h"
+#include "../Approaches/SolverRegistry.h"
+
+/**
+ * @brief One TruckAndPallets_X.csv / Pallets_X.csv pair found in a batch directory
+ * @var BatchEntry::name The X shared by both file names (e.g. "05")
+ * @var BatchEntry::truck_file Path to the TruckAndPallets CSV
+ * @var BatchEntry::pallet_file Path to the Pallets CSV
+ * @var BatchEntry::bytes Size of the pallet file, used to schedule the largest instances first
+ */
+struct BatchEntry
+{
+    std::string name;
+    std::string truck_file;
+    std::string pallet_file;
+    std::uintmax_t bytes;
+};
+
+/**
+ * @brief Settings of a batch run
+ * @var BatchOptions::solvers Registry names of the solvers to run on every instance
+ * @var BatchOptions::solver_options Settings passed to every solver
+ * @var BatchOptions::jobs Number of instances solved at once (0 uses the hardware concurrency)
+ * @var BatchOptions::limits Time and memory limits of each instance (loading included)
+ * @var BatchOptions::json Whether result lines are JSON objects instead of text
+ * @var BatchOptions::cache Solution cache consulted and filled by every instance (nullptr for none);
+ *      instances run in separate processes, so only its directory is shared between them
+ */
+struct BatchOptions
+{
+    std::vector<std::string> solvers;
+    SolverOptions solver_options;
+    unsigned int jobs = 0;
+    JobLimits limits;
+    bool json = false;
+    SolutionCache *cache = nullptr;
+};
+
+/**
+ * @brief Summary of a batch run
+ * @var BatchSummary::instances Number of instances scheduled
+ * @var BatchSummary::failed Instances that could not be read, timed out, ran out of memory or crashed
+ * @var BatchSummary::skipped Instances on which at least one solver was skipped
+ * @var BatchSummary::elapsed_ms Wall-clock time of the whole batch
+ */
+struct BatchSummary
+{
+    unsigned int instances = 0;
+    unsigned int failed = 0;
+    unsigned int skipped = 0;
+    double elapsed_ms = 0.0;
+};
+
+/**
+ * @brief Finds the instance pairs of a directory
+ * @param directory Directory laid out like datasets/ (TruckAndPallets_X.csv next to Pallets_X.csv)
+ * @return The pairs, sorted by name; pallet files without a truck file are reported on stderr and left out
+ */
+std::vector<BatchEntry> scanBatchDirectory(const std::string &directory);
+
+/**
+ * @brief Solves every instance and streams one result line per instance as soon as it is done
+ * @param entries Instances to solve
+ * @param options Solvers, pool size, limits and output format
+ * @param out Stream the result lines are written to (flushed after every line)
+ * @return BatchSummary with the failure and skip counts
+ * @note Each instance is loaded and solved in its own forked child (see runIsolatedJob), so a
+ *       timeout or an allocation failure only costs that instance. Up to options.jobs children
+ *       run at once, fed by a pool of threads from a queue sorted by decreasing pallet file size
+ *       (largest first), which keeps a long instance from starting last and delaying the end.
+ * @note Lines appear in completion order. A JSON line carries the instance name, the status
+ *       ("ok", "skipped", "input-error", "timeout", "out-of-memory", "crashed"), the instance
+ *       size, the time and the result of every solver in the format of OutputSolverResultJson.
+ */
+BatchSummary runBatch(const std::vector<BatchEntry> &entries, const BatchOptions &options, std::ostream &out);
+
+#endif // BATCHRUNNER_H
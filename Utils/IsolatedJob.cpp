@@ -0,0 +1,203 @@
+#include "IsolatedJob.h"
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fcntl.h>
+#include <mutex>
+#include <new>
+#include <poll.h>
+#include <set>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// read ends of the pipes of running jobs; a child must not keep them (or their write ends) open
+static std::mutex g_fork_mutex;
+static std::set<int> g_open_pipes;
+
+// writes the whole buffer, retrying on short writes
+static void writeAll(int fd, const std::string &data)
+{
+    size_t written = 0;
+    while (written < data.size())
+    {
+        ssize_t result = write(fd, data.data() + written, data.size() - written);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return;
+        written += result;
+    }
+}
+
+// size of the address space in bytes, 0 if unknown
+static unsigned long long addressSpaceBytes()
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm == nullptr)
+        return 0;
+    unsigned long long pages = 0;
+    if (fscanf(statm, "%llu", &pages) != 1)
+        pages = 0;
+    fclose(statm);
+    return pages * sysconf(_SC_PAGESIZE);
+}
+
+// runs in the child and never returns
+[[noreturn]] static void runChild(const std::function<int(std::string &)> &job, const JobLimits &limits, int fd)
+{
+    if (limits.memory_limit_bytes > 0)
+    {
+        // the child starts with the parent's mappings (thread stacks, malloc arenas), which the job did not ask for
+        rlim_t bytes = addressSpaceBytes() + limits.memory_limit_bytes;
+        struct rlimit limit = {bytes, bytes};
+        setrlimit(RLIMIT_AS, &limit);
+    }
+
+    std::string output;
+    int code;
+    try
+    {
+        code = job(output);
+    }
+    catch (const std::bad_alloc &)
+    {
+        _exit(ISOLATED_JOB_OUT_OF_MEMORY_EXIT);
+    }
+    catch (...)
+    {
+        _exit(ISOLATED_JOB_EXCEPTION_EXIT);
+    }
+    writeAll(fd, output);
+    close(fd);
+    // skip the parent's atexit handlers and static destructors
+    _exit(code);
+}
+
+JobOutcome runIsolatedJob(const std::function<int(std::string &output)> &job, const JobLimits &limits)
+{
+    JobOutcome outcome;
+    auto start = std::chrono::steady_clock::now();
+
+    int channel[2];
+    pid_t pid;
+    {
+        std::lock_guard<std::mutex> lock(g_fork_mutex);
+        if (pipe(channel) != 0)
+            return outcome;
+
+        pid = fork();
+        if (pid == 0)
+        {
+            for (int fd : g_open_pipes)
+                close(fd);
+            close(channel[0]);
+            runChild(job, limits, channel[1]);
+        }
+
+        close(channel[1]);
+        if (pid < 0)
+        {
+            close(channel[0]);
+            return outcome;
+        }
+        fcntl(channel[0], F_SETFD, FD_CLOEXEC);
+        g_open_pipes.insert(channel[0]);
+    }
+
+    auto elapsedMs = [&start]()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // read until end-of-file, which comes when the child exits
+    bool timedOut = false;
+    char buffer[65536];
+    while (true)
+    {
+        int timeout = -1;
+        if (limits.time_limit_ms > 0)
+        {
+            double left = limits.time_limit_ms - elapsedMs();
+            if (left <= 0)
+            {
+                timedOut = true;
+                break;
+            }
+            timeout = static_cast<int>(left) + 1;
+        }
+
+        struct pollfd event = {channel[0], POLLIN, 0};
+        int ready = poll(&event, 1, timeout);
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready == 0)
+            continue;
+
+        ssize_t count = read(channel[0], buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            break;
+        outcome.output.append(buffer, count);
+    }
+
+    if (timedOut)
+        kill(pid, SIGKILL);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+    {
+    }
+    outcome.elapsed_ms = elapsedMs();
+
+    {
+        std::lock_guard<std::mutex> lock(g_fork_mutex);
+        g_open_pipes.erase(channel[0]);
+        close(channel[0]);
+    }
+
+    if (timedOut)
+    {
+        outcome.status = JobStatus::TimedOut;
+    }
+    else if (WIFSIGNALED(status))
+    {
+        outcome.status = JobStatus::Crashed;
+        outcome.signal = WTERMSIG(status);
+    }
+    else if (WEXITSTATUS(status) == ISOLATED_JOB_OUT_OF_MEMORY_EXIT)
+    {
+        outcome.status = JobStatus::OutOfMemory;
+    }
+    else if (WEXITSTATUS(status) == ISOLATED_JOB_EXCEPTION_EXIT)
+    {
+        outcome.status = JobStatus::Crashed;
+    }
+    else
+    {
+        outcome.status = JobStatus::Finished;
+        outcome.exit_code = WEXITSTATUS(status);
+    }
+    if (outcome.status != JobStatus::Finished)
+        outcome.output.clear();
+    return outcome;
+}
+
+const char *jobStatusName(JobStatus status)
+{
+    switch (status)
+    {
+    case JobStatus::Finished:
+        return "finished";
+    case JobStatus::TimedOut:
+        return "timeout";
+    case JobStatus::OutOfMemory:
+        return "out-of-memory";
+    case JobStatus::Crashed:
+        return "crashed";
+    default:
+        return "not-started";
+    }
+}
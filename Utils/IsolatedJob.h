@@ -0,0 +1,84 @@
+/**
+ * @file IsolatedJob.h
+ * @brief Runs a piece of work in a forked child process under a time and memory limit
+ */
+
+#ifndef ISOLATEDJOB_H
+#define ISOLATEDJOB_H
+
+#include <functional>
+#include <string>
+
+/**
+ * @brief Exit code of a child whose job ran out of memory (std::bad_alloc)
+ */
+const int ISOLATED_JOB_OUT_OF_MEMORY_EXIT = 86;
+
+/**
+ * @brief Exit code of a child whose job threw any other exception
+ */
+const int ISOLATED_JOB_EXCEPTION_EXIT = 87;
+
+/**
+ * @brief Limits applied to one isolated job
+ * @var JobLimits::time_limit_ms Wall-clock limit in milliseconds, 0 for none
+ * @var JobLimits::memory_limit_bytes Address space the job may add in bytes, 0 for none
+ */
+struct JobLimits
+{
+    double time_limit_ms = 0.0;
+    unsigned long long memory_limit_bytes = 0;
+};
+
+/**
+ * @brief How an isolated job ended
+ */
+enum class JobStatus
+{
+    Finished,    ///< the job returned; its exit code is in JobOutcome::exit_code
+    TimedOut,    ///< the time limit passed and the child was killed
+    OutOfMemory, ///< an allocation failed under the memory limit
+    Crashed,     ///< the child died from a signal or threw an exception
+    NotStarted   ///< the pipe or the fork failed
+};
+
+/**
+ * @brief Outcome of an isolated job
+ * @var JobOutcome::status How the job ended
+ * @var JobOutcome::exit_code Value returned by the job (only meaningful when Finished)
+ * @var JobOutcome::signal Signal that killed the child (only meaningful when Crashed), 0 otherwise
+ * @var JobOutcome::output Everything the job wrote to its output string, empty unless Finished
+ * @var JobOutcome::elapsed_ms Wall-clock time from the fork to the end of the child
+ */
+struct JobOutcome
+{
+    JobStatus status = JobStatus::NotStarted;
+    int exit_code = 0;
+    int signal = 0;
+    std::string output;
+    double elapsed_ms = 0.0;
+};
+
+/**
+ * @brief Runs job in a forked child and collects what it produces
+ * @param job Work to do in the child; it fills in its output string and returns an exit code (0-85)
+ * @param limits Time and memory limits for the child
+ * @return JobOutcome with the status, the job's output and the elapsed time
+ * @note The memory limit is an RLIMIT_AS limit set on top of the address space the child starts
+ *       with, so it counts everything the job maps, thread stacks and mapped files included.
+ * @note Safe to call from several threads at once: forks are serialized, and each child closes
+ *       the pipes of the jobs running next to it, so every job sees end-of-file as soon as its
+ *       own child exits.
+ * @note The child inherits the parent's memory as it was at the fork, so data loaded before the
+ *       call does not have to be passed in; nothing the job changes comes back except its output.
+ */
+JobOutcome runIsolatedJob(const std::function<int(std::string &output)> &job, const JobLimits &limits);
+
+/**
+ * @brief Short name of a job status, as used in result lines
+ * @param status The status
+ * @return "finished", "timeout", "out-of-memory", "crashed" or "not-started"
+ */
+const char *jobStatusName(JobStatus status);
+
+#endif // ISOLATEDJOB_H
@@ -0,0 +1,132 @@
+#include "LoadGenerator.h"
+#include "SolveServer.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+static int connectTo(const std::string &socketPath)
+{
+    struct sockaddr_un address;
+    if (socketPath.size() >= sizeof(address.sun_path))
+        return -1;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+// what one client thread measured
+struct ClientRun
+{
+    bool ok = true;
+    unsigned long long sent = 0;
+    unsigned long long errors = 0;
+    std::vector<double> latencies;
+    std::string first_body;
+};
+
+static void runClient(const std::string &socketPath, std::string payload, const LoadGenOptions &options,
+                      ClientRun &run)
+{
+    int fd = connectTo(socketPath);
+    if (fd < 0)
+    {
+        run.ok = false;
+        return;
+    }
+
+    // deeper than the server's in-flight window, both sides could block writing at once
+    unsigned int depth = std::clamp(options.pipeline, 1u, SOLVE_SERVER_MAX_IN_FLIGHT);
+    std::vector<std::chrono::steady_clock::time_point> sentAt(options.requests);
+    unsigned int outstanding = 0;
+    std::string answer;
+    while (run.latencies.size() < options.requests)
+    {
+        while (outstanding < depth && run.sent < options.requests)
+        {
+            // the request id is the first field of the payload
+            uint32_t id = run.sent;
+            for (unsigned int k = 0; k < 4; k++)
+                payload[k] = static_cast<char>((id >> (8 * k)) & 0xff);
+            sentAt[id] = std::chrono::steady_clock::now();
+            if (!writeFrame(fd, payload))
+            {
+                run.ok = false;
+                close(fd);
+                return;
+            }
+            run.sent++;
+            outstanding++;
+        }
+
+        SolveResponse response;
+        if (!readFrame(fd, answer) || !decodeResponse(answer, response) || response.request_id >= run.sent)
+        {
+            run.ok = false;
+            break;
+        }
+        auto now = std::chrono::steady_clock::now();
+        run.latencies.push_back(std::chrono::duration<double, std::milli>(now - sentAt[response.request_id]).count());
+        outstanding--;
+        if (response.status == ResponseStatus::BadRequest || response.status == ResponseStatus::InputError)
+            run.errors++;
+        if (run.first_body.empty())
+            run.first_body = response.body;
+    }
+    close(fd);
+}
+
+bool runLoadGenerator(const std::string &socketPath, const SolveRequest &request, const LoadGenOptions &options,
+                      LoadGenStats &stats)
+{
+    signal(SIGPIPE, SIG_IGN);
+    std::string payload = encodeRequest(request);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ClientRun> runs(std::max(1u, options.clients));
+    std::vector<std::thread> clients;
+    for (ClientRun &run : runs)
+        clients.emplace_back(runClient, std::cref(socketPath), payload, std::cref(options), std::ref(run));
+    for (std::thread &client : clients)
+        client.join();
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    bool ok = true;
+    std::vector<double> latencies;
+    for (ClientRun &run : runs)
+    {
+        ok = ok && run.ok;
+        stats.sent += run.sent;
+        stats.errors += run.errors;
+        latencies.insert(latencies.end(), run.latencies.begin(), run.latencies.end());
+        if (stats.first_body.empty())
+            stats.first_body = run.first_body;
+    }
+    stats.answered = latencies.size();
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        double total = 0.0;
+        for (double latency : latencies)
+            total += latency;
+        stats.mean_ms = total / latencies.size();
+        stats.p50_ms = latencies[latencies.size() / 2];
+        stats.p99_ms = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+        stats.max_ms = latencies.back();
+    }
+    return ok;
+}
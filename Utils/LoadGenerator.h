@@ -0,0 +1,63 @@
+/**
+ * @file LoadGenerator.h
+ * @brief Local load generator for the solve server: concurrent clients with pipelined requests
+ */
+
+#ifndef LOADGENERATOR_H
+#define LOADGENERATOR_H
+
+#include <string>
+#include "SolveProtocol.h"
+
+/**
+ * @brief Shape of the generated load
+ * @var LoadGenOptions::clients Number of concurrent connections, one thread each
+ * @var LoadGenOptions::requests Requests sent by each client
+ * @var LoadGenOptions::pipeline Largest number of unanswered requests per client
+ */
+struct LoadGenOptions
+{
+    unsigned int clients = 1;
+    unsigned int requests = 100;
+    unsigned int pipeline = 1;
+};
+
+/**
+ * @brief Measurements of a load generator run
+ * @var LoadGenStats::sent Requests sent
+ * @var LoadGenStats::answered Responses received
+ * @var LoadGenStats::errors Responses with a BadRequest or InputError status, or undecodable
+ * @var LoadGenStats::elapsed_ms Wall-clock time of the run
+ * @var LoadGenStats::mean_ms Mean request latency (send to answer)
+ * @var LoadGenStats::p50_ms Median latency
+ * @var LoadGenStats::p99_ms 99th percentile latency
+ * @var LoadGenStats::max_ms Largest latency
+ * @var LoadGenStats::first_body Body of the first response, to check what the server answers
+ */
+struct LoadGenStats
+{
+    unsigned long long sent = 0;
+    unsigned long long answered = 0;
+    unsigned long long errors = 0;
+    double elapsed_ms = 0.0;
+    double mean_ms = 0.0;
+    double p50_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+    std::string first_body;
+};
+
+/**
+ * @brief Sends the same request many times to a solve server and measures the latencies
+ * @param socketPath Path of the server's Unix domain socket
+ * @param request Request to send; its id is replaced by a per-client sequence number
+ * @param options Number of clients, requests per client and pipeline depth
+ * @param stats Receives the measurements
+ * @return false if a client could not connect or the server closed a connection early
+ * @note The request is encoded once; each client keeps up to options.pipeline requests
+ *       unanswered on its connection and matches the answers by request id.
+ */
+bool runLoadGenerator(const std::string &socketPath, const SolveRequest &request, const LoadGenOptions &options,
+                      LoadGenStats &stats);
+
+#endif // LOADGENERATOR_H
@@ -0,0 +1,305 @@
+#include "SolutionCache.h"
+#include "Timing.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+// first bytes of every cache file, bumped when the layout changes
+static const char CACHE_FILE_MAGIC[8] = {'K', 'S', 'O', 'L', '0', '0', '0', '1'};
+
+static void appendWord(std::string &bytes, uint32_t value)
+{
+    for (unsigned int k = 0; k < 4; k++)
+        bytes.push_back(static_cast<char>((value >> (8 * k)) & 0xff));
+}
+
+// 64-bit FNV-1a, continued from seed
+static uint64_t fnv1a(const std::string &bytes, uint64_t seed = 14695981039346656037ull)
+{
+    uint64_t hash = seed;
+    for (char byte : bytes)
+    {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// the same instance solved by two solvers makes two entries
+static uint64_t entryHash(const NormalizedInstance &normalized, const std::string &solver)
+{
+    return fnv1a(solver, normalized.hash);
+}
+
+NormalizedInstance normalizeInstance(const InstanceView &instance)
+{
+    NormalizedInstance normalized;
+    const unsigned int *weights = instance.weights;
+    const unsigned int *profits = instance.profits;
+    const unsigned int *volumes = instance.volumes;
+
+    normalized.order.resize(instance.n);
+    for (unsigned int i = 0; i < instance.n; i++)
+        normalized.order[i] = i;
+    std::sort(normalized.order.begin(), normalized.order.end(), [&](unsigned int a, unsigned int b)
+    {
+        if (weights[a] != weights[b])
+            return weights[a] < weights[b];
+        if (profits[a] != profits[b])
+            return profits[a] < profits[b];
+        return volumes != nullptr && volumes[a] < volumes[b];
+    });
+
+    std::string &key = normalized.key;
+    unsigned int columns = volumes != nullptr ? 3 : 2;
+    key.reserve(20 + 4ull * columns * instance.n);
+    appendWord(key, instance.n);
+    appendWord(key, instance.capacity);
+    appendWord(key, instance.max_pallets);
+    appendWord(key, volumes != nullptr);
+    appendWord(key, volumes != nullptr ? instance.volume_capacity : 0);
+    for (unsigned int row : normalized.order)
+    {
+        appendWord(key, weights[row]);
+        appendWord(key, profits[row]);
+        if (volumes != nullptr)
+            appendWord(key, volumes[row]);
+    }
+    normalized.hash = fnv1a(key);
+    return normalized;
+}
+
+SolutionCache::SolutionCache(size_t maxBytes, const std::string &cacheDirectory)
+    : max_bytes(maxBytes), directory(cacheDirectory)
+{
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            std::cerr << "Cannot create the cache directory " << directory << ": " << error.message() << std::endl;
+            directory.clear();
+        }
+    }
+}
+
+std::string SolutionCache::filePath(uint64_t hash, const std::string &solver) const
+{
+    char name[17];
+    snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    return directory + "/" + name + "-" + solver + ".ksol";
+}
+
+bool SolutionCache::readFile(const std::string &path, Entry &entry) const
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t position = 0;
+    auto word = [&bytes, &position](uint32_t &value)
+    {
+        if (bytes.size() - position < 4)
+            return false;
+        value = 0;
+        for (unsigned int k = 0; k < 4; k++)
+            value |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[position + k])) << (8 * k);
+        position += 4;
+        return true;
+    };
+    auto text = [&bytes, &position, &word](std::string &value)
+    {
+        uint32_t length;
+        if (!word(length) || bytes.size() - position < length)
+            return false;
+        value.assign(bytes, position, length);
+        position += length;
+        return true;
+    };
+
+    if (bytes.size() < sizeof(CACHE_FILE_MAGIC) || bytes.compare(0, sizeof(CACHE_FILE_MAGIC),
+                                                                  CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)) != 0)
+        return false;
+    position = sizeof(CACHE_FILE_MAGIC);
+
+    uint32_t optimal, count;
+    SolverResult &result = entry.result;
+    if (!text(result.solver) || !text(entry.key) || !word(result.total_profit) || !word(result.total_weight) ||
+        !word(result.total_volume) || !word(result.pallet_count) || !word(optimal) || !text(result.message) ||
+        !word(count) || (bytes.size() - position) / 4 < count)
+        return false;
+    result.optimal = optimal != 0;
+    entry.positions.resize(count);
+    for (uint32_t &value : entry.positions)
+        word(value);
+    return position == bytes.size();
+}
+
+void SolutionCache::writeFile(const std::string &path, const Entry &entry) const
+{
+    const SolverResult &result = entry.result;
+    std::string bytes(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    appendWord(bytes, result.solver.size());
+    bytes += result.solver;
+    appendWord(bytes, entry.key.size());
+    bytes += entry.key;
+    appendWord(bytes, result.total_profit);
+    appendWord(bytes, result.total_weight);
+    appendWord(bytes, result.total_volume);
+    appendWord(bytes, result.pallet_count);
+    appendWord(bytes, result.optimal);
+    appendWord(bytes, result.message.size());
+    bytes += result.message;
+    appendWord(bytes, entry.positions.size());
+    for (unsigned int position : entry.positions)
+        appendWord(bytes, position);
+
+    // readers never see a half-written file: write aside, then rename over
+    std::ostringstream temporary;
+    temporary << path << ".tmp." << getpid() << "." << std::this_thread::get_id();
+    {
+        std::ofstream file(temporary.str(), std::ios::binary | std::ios::trunc);
+        if (!file.is_open() || !file.write(bytes.data(), bytes.size()))
+            return;
+    }
+    if (std::rename(temporary.str().c_str(), path.c_str()) != 0)
+        std::remove(temporary.str().c_str());
+}
+
+// caller holds the mutex
+void SolutionCache::insert(Entry entry)
+{
+    auto existing = index.find(entry.hash);
+    if (existing != index.end())
+    {
+        counters.bytes -= existing->second->bytes;
+        entries.erase(existing->second);
+        index.erase(existing);
+    }
+    if (entry.bytes > max_bytes)
+    {
+        counters.entries = entries.size();
+        return;
+    }
+
+    counters.bytes += entry.bytes;
+    entries.push_front(std::move(entry));
+    index[entries.front().hash] = entries.begin();
+    while (counters.bytes > max_bytes)
+    {
+        counters.bytes -= entries.back().bytes;
+        index.erase(entries.back().hash);
+        entries.pop_back();
+    }
+    counters.entries = entries.size();
+}
+
+bool SolutionCache::lookup(const std::string &solver, const InstanceView &instance,
+                           const NormalizedInstance &normalized, SolverResult &result)
+{
+    uint64_t hash = entryHash(normalized, solver);
+    std::vector<unsigned int> positions;
+    bool hit = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(hash);
+        // equal hashes with different keys are a collision, not a hit
+        if (it != index.end() && it->second->result.solver == solver && it->second->key == normalized.key)
+        {
+            entries.splice(entries.begin(), entries, it->second);
+            result = it->second->result;
+            positions = it->second->positions;
+            counters.hits++;
+            hit = true;
+        }
+    }
+
+    Entry found;
+    if (!hit && !directory.empty() && readFile(filePath(hash, solver), found) &&
+        found.result.solver == solver && found.key == normalized.key)
+    {
+        result = found.result;
+        positions = found.positions;
+        found.hash = hash;
+        found.bytes = sizeof(Entry) + found.key.size() + 4 * found.positions.size() + found.result.message.size();
+        std::lock_guard<std::mutex> lock(mutex);
+        insert(std::move(found));
+        counters.disk_hits++;
+        hit = true;
+    }
+    if (!hit)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        counters.misses++;
+        return false;
+    }
+
+    // selections are stored by sorted position; map them onto this instance's rows
+    result.ran = true;
+    result.used_pallets.assign(instance.n, false);
+    for (unsigned int position : positions)
+        result.used_pallets[normalized.order[position]] = true;
+    return true;
+}
+
+void SolutionCache::store(const std::string &solver, const NormalizedInstance &normalized,
+                          const SolverResult &result)
+{
+    if (!result.ran || !result.optimal)
+        return;
+
+    Entry entry;
+    entry.key = normalized.key;
+    entry.hash = entryHash(normalized, solver);
+    entry.result = result;
+    entry.result.used_pallets.clear();
+    entry.result.elapsed_ms = entry.result.user_ms = entry.result.sys_ms = 0.0;
+    for (unsigned int position = 0; position < normalized.order.size(); position++)
+    {
+        if (result.used_pallets[normalized.order[position]])
+            entry.positions.push_back(position);
+    }
+    entry.bytes = sizeof(Entry) + entry.key.size() + 4 * entry.positions.size() + entry.result.message.size();
+
+    if (!directory.empty())
+        writeFile(filePath(entry.hash, solver), entry);
+    std::lock_guard<std::mutex> lock(mutex);
+    insert(std::move(entry));
+}
+
+SolutionCacheStats SolutionCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+}
+
+SolverResult runSolverCached(SolutionCache *cache, const SolverInfo &solver, const InstanceView &instance,
+                             const SolverOptions &options)
+{
+    if (cache == nullptr)
+        return runSolver(solver, instance, options);
+
+    Stopwatch stopwatch;
+    NormalizedInstance normalized = normalizeInstance(instance);
+    SolverResult result;
+    if (cache->lookup(solver.name, instance, normalized, result))
+    {
+        result.cached = true;
+        TimingSample time = stopwatch.elapsed();
+        result.elapsed_ms = time.wall_ms;
+        result.user_ms = time.user_ms;
+        result.sys_ms = time.sys_ms;
+        return result;
+    }
+
+    result = runSolver(solver, instance, options);
+    cache->store(solver.name, normalized, result);
+    return result;
+}
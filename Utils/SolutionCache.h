@@ -0,0 +1,141 @@
+/**
+ * @file SolutionCache.h
+ * @brief Content-addressed cache of solver results, keyed by a hash of the normalized instance
+ */
+
+#ifndef SOLUTIONCACHE_H
+#define SOLUTIONCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../Approaches/SolverRegistry.h"
+
+/**
+ * @brief Default memory budget of the in-memory cache (keys and selections included)
+ */
+const size_t SOLUTION_CACHE_DEFAULT_BYTES = 64u << 20;
+
+/**
+ * @brief An instance reduced to what the solvers see, independent of pallet ids and row order
+ * @var NormalizedInstance::key Capacities, pallet limit and the (weight, profit[, volume]) tuples in sorted order
+ * @var NormalizedInstance::hash 64-bit FNV-1a hash of key
+ * @var NormalizedInstance::order Row of the original instance at each sorted position
+ */
+struct NormalizedInstance
+{
+    std::string key;
+    uint64_t hash = 0;
+    std::vector<unsigned int> order;
+};
+
+/**
+ * @brief Normalizes an instance for the cache
+ * @param instance Instance to normalize
+ * @return The key, its hash and the sorted-position-to-row mapping
+ * @note Pallets with the same weight, profit and volume are interchangeable, so any two
+ *       instances with equal keys have the same solutions up to that mapping.
+ * @note Time Complexity: O(n log n) for the sort
+ */
+NormalizedInstance normalizeInstance(const InstanceView &instance);
+
+/**
+ * @brief Hit and miss counters of a SolutionCache
+ * @var SolutionCacheStats::hits Lookups answered from memory
+ * @var SolutionCacheStats::disk_hits Lookups answered from the cache directory
+ * @var SolutionCacheStats::misses Lookups that found nothing
+ * @var SolutionCacheStats::entries Results held in memory
+ * @var SolutionCacheStats::bytes Memory held by those results
+ */
+struct SolutionCacheStats
+{
+    unsigned long long hits = 0;
+    unsigned long long disk_hits = 0;
+    unsigned long long misses = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+};
+
+/**
+ * @brief LRU cache of proven-optimal solver results, optionally backed by a directory
+ * @note Results are stored per solver and normalized instance, with the selection as sorted
+ *       positions, and are mapped back onto the rows (and pallet ids) of whichever instance
+ *       asks. Only results marked optimal are kept: heuristics are cheap to rerun and their
+ *       answers depend on the budget and the random seed.
+ * @note Safe to share between threads. Files in the directory are written to a temporary
+ *       name and renamed, so concurrent processes may share a directory.
+ */
+class SolutionCache
+{
+private:
+    struct Entry
+    {
+        std::string key;
+        uint64_t hash;
+        SolverResult result;
+        std::vector<unsigned int> positions;
+        size_t bytes;
+    };
+
+    size_t max_bytes;
+    std::string directory;
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+    SolutionCacheStats counters;
+
+    void insert(Entry entry);
+    std::string filePath(uint64_t hash, const std::string &solver) const;
+    bool readFile(const std::string &path, Entry &entry) const;
+    void writeFile(const std::string &path, const Entry &entry) const;
+
+public:
+    /**
+     * @brief Creates an empty cache
+     * @param maxBytes Memory budget; the least recently used results are dropped beyond it
+     * @param cacheDirectory Directory of the on-disk cache, created if missing ("" for memory only)
+     */
+    explicit SolutionCache(size_t maxBytes = SOLUTION_CACHE_DEFAULT_BYTES, const std::string &cacheDirectory = "");
+
+    /**
+     * @brief Looks up the result of a solver on an instance
+     * @param solver Registry name of the solver
+     * @param instance The instance being solved
+     * @param normalized normalizeInstance(instance)
+     * @param result Receives the cached result, with the selection mapped onto instance's rows
+     * @return true on a hit
+     * @note Time Complexity: O(n) to compare the key and map the selection back
+     */
+    bool lookup(const std::string &solver, const InstanceView &instance, const NormalizedInstance &normalized,
+                SolverResult &result);
+
+    /**
+     * @brief Stores a result if it is proven optimal
+     * @param solver Registry name of the solver
+     * @param normalized normalizeInstance of the instance that was solved
+     * @param result The solver's result on that instance
+     */
+    void store(const std::string &solver, const NormalizedInstance &normalized, const SolverResult &result);
+
+    /**
+     * @brief Current counters
+     * @return A copy of the counters
+     */
+    SolutionCacheStats stats() const;
+};
+
+/**
+ * @brief runSolver with a cache in front of it
+ * @param cache Cache to consult and fill (nullptr runs the solver directly)
+ * @param solver Registry entry to run
+ * @param instance Instance to solve
+ * @param options Solver settings
+ * @return The cached result (with cached set and elapsed_ms the lookup time) or the solver's result
+ */
+SolverResult runSolverCached(SolutionCache *cache, const SolverInfo &solver, const InstanceView &instance,
+                             const SolverOptions &options);
+
+#endif // SOLUTIONCACHE_H
@@ -0,0 +1,277 @@
+#include "SolveProtocol.h"
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+
+// flag bit 0 of a request: the inline instance has a volume column
+static const uint8_t REQUEST_FLAG_VOLUMES = 1;
+
+// appends little-endian integers and length-prefixed strings to a payload
+class ByteWriter
+{
+private:
+    std::string &bytes;
+
+public:
+    explicit ByteWriter(std::string &target) : bytes(target) {}
+
+    void put(uint64_t value, unsigned int size)
+    {
+        for (unsigned int k = 0; k < size; k++)
+            bytes.push_back(static_cast<char>((value >> (8 * k)) & 0xff));
+    }
+
+    void putString(const std::string &text, unsigned int lengthSize)
+    {
+        put(text.size(), lengthSize);
+        bytes += text;
+    }
+
+    void putColumn(const unsigned int column[], unsigned int n)
+    {
+        for (unsigned int i = 0; i < n; i++)
+            put(column[i], 4);
+    }
+};
+
+// reads what ByteWriter wrote; every read fails once the payload is exhausted
+class ByteReader
+{
+private:
+    const std::string &bytes;
+    size_t position;
+
+public:
+    explicit ByteReader(const std::string &source) : bytes(source), position(0) {}
+
+    size_t remaining() const { return bytes.size() - position; }
+
+    bool get(uint64_t &value, unsigned int size)
+    {
+        if (remaining() < size)
+            return false;
+        value = 0;
+        for (unsigned int k = 0; k < size; k++)
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[position + k])) << (8 * k);
+        position += size;
+        return true;
+    }
+
+    bool getString(std::string &text, unsigned int lengthSize)
+    {
+        uint64_t length;
+        if (!get(length, lengthSize) || remaining() < length)
+            return false;
+        text.assign(bytes, position, length);
+        position += length;
+        return true;
+    }
+
+    bool getColumn(AlignedVector<unsigned int> &column, unsigned int n)
+    {
+        if (remaining() / 4 < n)
+            return false;
+        column.resize(n);
+        uint64_t value = 0;
+        for (unsigned int i = 0; i < n; i++)
+        {
+            get(value, 4);
+            column[i] = value;
+        }
+        return true;
+    }
+
+    std::string rest()
+    {
+        std::string text = bytes.substr(position);
+        position = bytes.size();
+        return text;
+    }
+};
+
+std::string encodeRequest(const SolveRequest &request)
+{
+    std::string payload;
+    ByteWriter writer(payload);
+    const Instance &instance = request.instance;
+    bool volumes = request.kind == RequestKind::Inline && instance.hasVolumes();
+
+    std::string solvers;
+    for (const std::string &name : request.solvers)
+        solvers += (solvers.empty() ? "" : ",") + name;
+
+    uint64_t budgetBits;
+    memcpy(&budgetBits, &request.options.time_budget_ms, sizeof(budgetBits));
+
+    writer.put(request.request_id, 4);
+    writer.put(static_cast<uint8_t>(request.kind), 1);
+    writer.put(volumes ? REQUEST_FLAG_VOLUMES : 0, 1);
+    writer.putString(solvers, 2);
+    writer.put(budgetBits, 8);
+    writer.put(request.options.threads, 4);
+
+    switch (request.kind)
+    {
+    case RequestKind::Inline:
+        writer.put(instance.size(), 4);
+        writer.put(instance.capacity, 4);
+        writer.put(instance.volume_capacity, 4);
+        writer.put(instance.max_pallets, 4);
+        writer.putColumn(instance.pallets.data(), instance.size());
+        writer.putColumn(instance.weights.data(), instance.size());
+        writer.putColumn(instance.profits.data(), instance.size());
+        if (volumes)
+            writer.putColumn(instance.volumes.data(), instance.size());
+        break;
+    case RequestKind::CsvPaths:
+        writer.putString(request.truck_file, 4);
+        writer.putString(request.pallet_file, 4);
+        break;
+    case RequestKind::BinaryPath:
+        writer.putString(request.pallet_file, 4);
+        break;
+    }
+    return payload;
+}
+
+bool decodeRequest(const std::string &payload, SolveRequest &request, std::string &error)
+{
+    ByteReader reader(payload);
+    uint64_t id, kind, flags, budgetBits, threads;
+    std::string solvers;
+    if (!reader.get(id, 4))
+    {
+        error = "truncated request";
+        return false;
+    }
+    request.request_id = id;
+
+    if (!reader.get(kind, 1) || !reader.get(flags, 1) || !reader.getString(solvers, 2) ||
+        !reader.get(budgetBits, 8) || !reader.get(threads, 4))
+    {
+        error = "truncated request header";
+        return false;
+    }
+    if (kind > static_cast<uint64_t>(RequestKind::BinaryPath))
+    {
+        error = "unknown request kind " + std::to_string(kind);
+        return false;
+    }
+    request.kind = static_cast<RequestKind>(kind);
+    memcpy(&request.options.time_budget_ms, &budgetBits, sizeof(budgetBits));
+    if (!std::isfinite(request.options.time_budget_ms) || request.options.time_budget_ms < 0)
+    {
+        error = "invalid time budget";
+        return false;
+    }
+    request.options.threads = threads;
+
+    request.solvers.clear();
+    size_t start = 0;
+    while (start < solvers.size())
+    {
+        size_t comma = solvers.find(',', start);
+        if (comma == std::string::npos)
+            comma = solvers.size();
+        if (comma > start)
+            request.solvers.push_back(solvers.substr(start, comma - start));
+        start = comma + 1;
+    }
+
+    bool complete = true;
+    if (request.kind == RequestKind::Inline)
+    {
+        uint64_t n = 0, capacity = 0, volumeCapacity = 0, maxPallets = 0;
+        Instance &instance = request.instance;
+        complete = reader.get(n, 4) && reader.get(capacity, 4) && reader.get(volumeCapacity, 4) &&
+                   reader.get(maxPallets, 4) && reader.getColumn(instance.pallets, n) &&
+                   reader.getColumn(instance.weights, n) && reader.getColumn(instance.profits, n) &&
+                   ((flags & REQUEST_FLAG_VOLUMES) == 0 || reader.getColumn(instance.volumes, n));
+        instance.capacity = capacity;
+        instance.volume_capacity = volumeCapacity;
+        instance.max_pallets = maxPallets;
+    }
+    else if (request.kind == RequestKind::CsvPaths)
+    {
+        complete = reader.getString(request.truck_file, 4) && reader.getString(request.pallet_file, 4);
+    }
+    else
+    {
+        complete = reader.getString(request.pallet_file, 4);
+    }
+
+    if (!complete)
+    {
+        error = "truncated request body";
+        return false;
+    }
+    if (reader.remaining() != 0)
+    {
+        error = "trailing bytes after the request";
+        return false;
+    }
+    return true;
+}
+
+std::string encodeResponse(const SolveResponse &response)
+{
+    std::string payload;
+    ByteWriter writer(payload);
+    writer.put(response.request_id, 4);
+    writer.put(static_cast<uint8_t>(response.status), 1);
+    payload += response.body;
+    return payload;
+}
+
+bool decodeResponse(const std::string &payload, SolveResponse &response)
+{
+    ByteReader reader(payload);
+    uint64_t id, status;
+    if (!reader.get(id, 4) || !reader.get(status, 1) || status > static_cast<uint64_t>(ResponseStatus::InputError))
+        return false;
+    response.request_id = id;
+    response.status = static_cast<ResponseStatus>(status);
+    response.body = reader.rest();
+    return true;
+}
+
+// writes or reads exactly size bytes, retrying on short transfers and EINTR
+static bool transferAll(int fd, char *data, size_t size, bool writing)
+{
+    size_t done = 0;
+    while (done < size)
+    {
+        ssize_t result = writing ? write(fd, data + done, size - done) : read(fd, data + done, size - done);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return false;
+        done += result;
+    }
+    return true;
+}
+
+bool writeFrame(int fd, const std::string &payload)
+{
+    std::string frame;
+    ByteWriter writer(frame);
+    writer.put(payload.size(), 4);
+    frame += payload;
+    return transferAll(fd, frame.data(), frame.size(), true);
+}
+
+bool readFrame(int fd, std::string &payload)
+{
+    char prefix[4];
+    if (!transferAll(fd, prefix, sizeof(prefix), false))
+        return false;
+    uint32_t length = 0;
+    for (unsigned int k = 0; k < 4; k++)
+        length |= static_cast<uint32_t>(static_cast<unsigned char>(prefix[k])) << (8 * k);
+    if (length > SOLVE_PROTOCOL_MAX_FRAME)
+        return false;
+
+    payload.resize(length);
+    return transferAll(fd, payload.data(), length, false);
+}
@@ -0,0 +1,141 @@
+/**
+ * @file SolveProtocol.h
+ * @brief Length-prefixed binary protocol between the solve server and its clients
+ *
+ * Every message is a frame: a 4-byte little-endian payload length followed by the payload.
+ * Integers in payloads are little-endian, strings are a length followed by their bytes.
+ *
+ * Request payload:
+ *   u32 request id | u8 kind | u8 flags | u16 solver list length | solver list ("dp,bt")
+ *   | u64 time budget (IEEE double bits, ms) | u32 threads | body
+ * Body by kind:
+ *   Inline      u32 n | u32 capacity | u32 volume capacity | u32 max pallets
+ *               | n × u32 pallet IDs | n × u32 weights | n × u32 profits | n × u32 volumes (flag bit 0)
+ *   CsvPaths    u32 length | truck CSV path | u32 length | pallet CSV path
+ *   BinaryPath  u32 length | .kbin path
+ *
+ * Response payload:
+ *   u32 request id | u8 status | JSON body (rest of the payload)
+ *
+ * Responses carry the id of their request, so a client may pipeline requests on one
+ * connection and match the answers, which can come back in any order.
+ */
+
+#ifndef SOLVEPROTOCOL_H
+#define SOLVEPROTOCOL_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Approaches/SolverRegistry.h"
+#include "../ReadData/Instance.h"
+
+/**
+ * @brief Largest frame payload accepted, in bytes (a frame announcing more closes the connection)
+ */
+const uint32_t SOLVE_PROTOCOL_MAX_FRAME = 256u << 20;
+
+/**
+ * @brief Where the instance of a request comes from
+ */
+enum class RequestKind : uint8_t
+{
+    Inline = 0,    ///< the pallets are in the request
+    CsvPaths = 1,  ///< a TruckAndPallets / Pallets CSV pair on the server's file system
+    BinaryPath = 2 ///< a .kbin file on the server's file system
+};
+
+/**
+ * @brief Outcome of a request, as sent in the response
+ */
+enum class ResponseStatus : uint8_t
+{
+    Ok = 0,         ///< every solver ran
+    Skipped = 1,    ///< at least one solver was skipped (see the messages in the body)
+    BadRequest = 2, ///< the request could not be decoded or names an unknown solver
+    InputError = 3  ///< the instance files could not be read
+};
+
+/**
+ * @brief Decoded solve request
+ * @var SolveRequest::request_id Id echoed in the response
+ * @var SolveRequest::kind Where the instance comes from
+ * @var SolveRequest::solvers Registry names of the solvers to run
+ * @var SolveRequest::options Solver settings
+ * @var SolveRequest::instance The pallets (Inline only)
+ * @var SolveRequest::truck_file TruckAndPallets CSV path (CsvPaths only)
+ * @var SolveRequest::pallet_file Pallets CSV path (CsvPaths) or .kbin path (BinaryPath)
+ */
+struct SolveRequest
+{
+    uint32_t request_id = 0;
+    RequestKind kind = RequestKind::Inline;
+    std::vector<std::string> solvers;
+    SolverOptions options;
+    Instance instance;
+    std::string truck_file;
+    std::string pallet_file;
+};
+
+/**
+ * @brief Decoded solve response
+ * @var SolveResponse::request_id Id of the request answered
+ * @var SolveResponse::status Outcome of the request
+ * @var SolveResponse::body JSON document with the results, or {"error": ...}
+ */
+struct SolveResponse
+{
+    uint32_t request_id = 0;
+    ResponseStatus status = ResponseStatus::Ok;
+    std::string body;
+};
+
+/**
+ * @brief Encodes a request payload
+ * @param request The request
+ * @return The payload, without the frame length
+ */
+std::string encodeRequest(const SolveRequest &request);
+
+/**
+ * @brief Decodes a request payload
+ * @param payload The payload, without the frame length
+ * @param request Receives the request
+ * @param error Receives what is wrong with the payload
+ * @return true if the payload is a well-formed request
+ * @note The request id is filled in as soon as it has been read, so an error can still be answered.
+ */
+bool decodeRequest(const std::string &payload, SolveRequest &request, std::string &error);
+
+/**
+ * @brief Encodes a response payload
+ * @param response The response
+ * @return The payload, without the frame length
+ */
+std::string encodeResponse(const SolveResponse &response);
+
+/**
+ * @brief Decodes a response payload
+ * @param payload The payload, without the frame length
+ * @param response Receives the response
+ * @return true if the payload is a well-formed response
+ */
+bool decodeResponse(const std::string &payload, SolveResponse &response);
+
+/**
+ * @brief Writes one frame (length prefix and payload) to a socket
+ * @param fd Socket or pipe file descriptor
+ * @param payload The payload
+ * @return true if everything was written
+ */
+bool writeFrame(int fd, const std::string &payload);
+
+/**
+ * @brief Reads one frame from a socket
+ * @param fd Socket or pipe file descriptor
+ * @param payload Receives the payload
+ * @return false at end of file, on a read error or when the frame exceeds SOLVE_PROTOCOL_MAX_FRAME
+ */
+bool readFrame(int fd, std::string &payload);
+
+#endif // SOLVEPROTOCOL_H
@@ -0,0 +1,323 @@
+#include "SolveServer.h"
+#include "../Output/Output.h"
+#include "../Output/ProgressBar.h"
+#include "../ReadData/BinaryInstance.h"
+#include "../ReadData/read.h"
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+// set by SIGINT / SIGTERM, polled by the accept loop
+static volatile sig_atomic_t g_stop_requested = 0;
+
+static void requestStop(int)
+{
+    g_stop_requested = 1;
+}
+
+/**
+ * One client connection, shared by its reader thread and the workers answering its requests.
+ */
+struct Connection
+{
+    int fd;
+    std::mutex write_mutex;
+    std::mutex flight_mutex;
+    std::condition_variable flight_done;
+    unsigned int in_flight = 0;
+    std::atomic<bool> finished{false};
+    // set once a write failed or timed out; the stream is then out of sync and nothing more is sent
+    std::atomic<bool> dropped{false};
+
+    explicit Connection(int socket) : fd(socket) {}
+    ~Connection() { close(fd); }
+};
+
+/**
+ * Fixed set of threads running queued tasks; the destructor finishes the queue before joining.
+ */
+class WorkerPool
+{
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+    std::vector<std::thread> threads;
+
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+public:
+    explicit WorkerPool(unsigned int size)
+    {
+        for (unsigned int i = 0; i < size; i++)
+            threads.emplace_back(&WorkerPool::work, this);
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        ready.notify_one();
+    }
+};
+
+static SolveResponse errorResponse(uint32_t id, ResponseStatus status, const std::string &message)
+{
+    return {id, status, "{\"id\":" + std::to_string(id) + ",\"error\":" + jsonQuote(message) + "}"};
+}
+
+SolveResponse handleSolveRequest(const SolveRequest &request, SolutionCache *cache)
+{
+    if (request.solvers.empty())
+        return errorResponse(request.request_id, ResponseStatus::BadRequest, "no solver given");
+    for (const std::string &name : request.solvers)
+    {
+        if (findSolver(name) == nullptr)
+            return errorResponse(request.request_id, ResponseStatus::BadRequest, "unknown solver: " + name);
+    }
+
+    Instance loaded;
+    std::unique_ptr<BinaryInstance> binary;
+    InstanceView instance;
+    if (request.kind == RequestKind::Inline)
+    {
+        instance = request.instance.view();
+    }
+    else if (request.kind == RequestKind::CsvPaths)
+    {
+        if (!readInstance(request.truck_file, request.pallet_file, loaded))
+            return errorResponse(request.request_id, ResponseStatus::InputError, "cannot read the instance files");
+        instance = loaded.view();
+    }
+    else
+    {
+        binary = std::make_unique<BinaryInstance>(request.pallet_file);
+        if (!binary->isValid())
+            return errorResponse(request.request_id, ResponseStatus::InputError, binary->error());
+        instance = binary->view();
+    }
+
+    SolverOptions options = request.options;
+    // the workers already keep every core busy
+    if (options.threads == 0)
+        options.threads = 1;
+
+    std::ostringstream body;
+    bool skipped = false;
+    body << "{\"id\":" << request.request_id << ",\"n\":" << instance.n << ",\"capacity\":" << instance.capacity
+         << ",\"results\":[";
+    for (size_t k = 0; k < request.solvers.size(); k++)
+    {
+        SolverResult result = runSolverCached(cache, *findSolver(request.solvers[k]), instance, options);
+        skipped = skipped || !result.ran;
+        body << (k == 0 ? "" : ",");
+        OutputSolverResultJson(body, instance, result);
+    }
+    body << "]}";
+    return {request.request_id, skipped ? ResponseStatus::Skipped : ResponseStatus::Ok, body.str()};
+}
+
+// reads the frames of one connection and queues them; runs on its own thread
+static void serveConnection(const std::shared_ptr<Connection> &connection, WorkerPool &pool, SolutionCache *cache,
+                            std::atomic<unsigned long long> &served)
+{
+    std::string payload;
+    while (readFrame(connection->fd, payload))
+    {
+        // backpressure: a client pipelining faster than we solve waits here
+        {
+            std::unique_lock<std::mutex> lock(connection->flight_mutex);
+            connection->flight_done.wait(lock, [&connection]()
+                                         { return connection->in_flight < SOLVE_SERVER_MAX_IN_FLIGHT; });
+            connection->in_flight++;
+        }
+
+        auto frame = std::make_shared<std::string>(std::move(payload));
+        pool.submit([connection, frame, cache, &served]()
+        {
+            if (!connection->dropped)
+            {
+                SolveRequest request;
+                std::string error;
+                SolveResponse response = decodeRequest(*frame, request, error)
+                                             ? handleSolveRequest(request, cache)
+                                             : errorResponse(request.request_id, ResponseStatus::BadRequest, error);
+                std::lock_guard<std::mutex> lock(connection->write_mutex);
+                if (connection->dropped)
+                {
+                    // another worker gave up on this client while we were solving
+                }
+                else if (writeFrame(connection->fd, encodeResponse(response)))
+                {
+                    served++;
+                }
+                else
+                {
+                    // the client stopped reading (send timeout) or hung up: end its reader too
+                    connection->dropped = true;
+                    shutdown(connection->fd, SHUT_RDWR);
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(connection->flight_mutex);
+                connection->in_flight--;
+            }
+            connection->flight_done.notify_one();
+        });
+        payload.clear();
+    }
+    connection->finished = true;
+}
+
+// binds and listens on the socket path, replacing a stale socket file; -1 on failure
+static int openListeningSocket(const std::string &socketPath)
+{
+    struct sockaddr_un address;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Socket path is too long: " << socketPath << std::endl;
+        return -1;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath.c_str());
+
+    struct stat existing;
+    if (stat(socketPath.c_str(), &existing) == 0 && S_ISSOCK(existing.st_mode))
+        unlink(socketPath.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        std::cerr << "Failed to create a socket: " << strerror(errno) << std::endl;
+        return -1;
+    }
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        std::cerr << "Failed to listen on " << socketPath << ": " << strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool runSolveServer(const std::string &socketPath, unsigned int workers, SolutionCache *cache)
+{
+    int listener = openListeningSocket(socketPath);
+    if (listener < 0)
+        return false;
+
+    ProgressBar::setHeadless(true);
+    // a client hanging up must not kill the server, the failed write is ignored instead
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = requestStop;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    g_stop_requested = 0;
+
+    if (workers == 0)
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<unsigned long long> served(0);
+    std::cerr << "Listening on " << socketPath << " with " << workers << " workers (Ctrl+C to stop)" << std::endl;
+
+    {
+        WorkerPool pool(workers);
+        std::list<std::pair<std::shared_ptr<Connection>, std::thread>> connections;
+
+        while (!g_stop_requested)
+        {
+            // join the readers of closed connections
+            for (auto it = connections.begin(); it != connections.end();)
+            {
+                if (it->first->finished)
+                {
+                    it->second.join();
+                    it = connections.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            struct pollfd event = {listener, POLLIN, 0};
+            if (poll(&event, 1, 250) <= 0)
+                continue;
+            int client = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client < 0)
+                continue;
+
+            struct timeval sendTimeout = {SOLVE_SERVER_SEND_TIMEOUT_MS / 1000,
+                                          static_cast<suseconds_t>(SOLVE_SERVER_SEND_TIMEOUT_MS % 1000 * 1000)};
+            setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+
+            auto connection = std::make_shared<Connection>(client);
+            connections.emplace_back(connection, std::thread(serveConnection, connection, std::ref(pool),
+                                                             cache, std::ref(served)));
+        }
+
+        // stop reading new requests; the ones already queued are still answered
+        for (auto &[connection, thread] : connections)
+            shutdown(connection->fd, SHUT_RD);
+        for (auto &[connection, thread] : connections)
+            thread.join();
+    }
+
+    close(listener);
+    unlink(socketPath.c_str());
+    std::cerr << "Stopped after serving " << served << " requests";
+    if (cache != nullptr)
+    {
+        SolutionCacheStats stats = cache->stats();
+        std::cerr << " (cache: " << stats.hits << " hits, " << stats.disk_hits << " from disk, " << stats.misses
+                  << " misses)";
+    }
+    std::cerr << std::endl;
+    return true;
+}
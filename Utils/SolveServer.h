@@ -0,0 +1,51 @@
+/**
+ * @file SolveServer.h
+ * @brief Long-running solve server listening on a Unix domain socket
+ */
+
+#ifndef SOLVESERVER_H
+#define SOLVESERVER_H
+
+#include <string>
+#include "SolveProtocol.h"
+#include "SolutionCache.h"
+
+/**
+ * @brief Largest number of requests of one connection that may be queued or solving at once;
+ *        beyond it the server stops reading that connection until answers have gone out
+ */
+const unsigned int SOLVE_SERVER_MAX_IN_FLIGHT = 64;
+
+/**
+ * @brief How long writing one answer may block on a client that does not read; past it the
+ *        connection is dropped, so such a client cannot hold the workers
+ */
+const unsigned int SOLVE_SERVER_SEND_TIMEOUT_MS = 5000;
+
+/**
+ * @brief Solves one decoded request, as the server does
+ * @param request The request (its instance is used in place for Inline requests)
+ * @param cache Solution cache shared by the workers (nullptr to always solve)
+ * @return The response, with the results as a JSON document
+ * @note The body is {"id":…,"n":…,"capacity":…,"results":[…]} with one object per solver in
+ *       the format of OutputSolverResultJson, or {"id":…,"error":…} for a failed request.
+ * @note A request asking for 0 threads gets 1, since the server already runs one request per core.
+ */
+SolveResponse handleSolveRequest(const SolveRequest &request, SolutionCache *cache = nullptr);
+
+/**
+ * @brief Serves solve requests on a Unix domain socket until SIGINT or SIGTERM
+ * @param socketPath Path of the socket; a stale socket file at that path is replaced
+ * @param workers Number of worker threads solving requests (0 uses the hardware concurrency)
+ * @param cache Solution cache shared by the workers (nullptr to always solve)
+ * @return true after a clean shutdown, false if the socket could not be set up
+ * @note One thread per connection reads frames and queues them for the fixed pool of workers,
+ *       which stays warm (threads and their malloc arenas) between requests. A connection may
+ *       pipeline requests: each answer is written, tagged with its request id, as soon as its
+ *       worker is done, under a per-connection write lock. A write that fails or blocks for
+ *       SOLVE_SERVER_SEND_TIMEOUT_MS drops the connection; its queued requests are discarded.
+ * @note Progress bars are switched to headless mode for the lifetime of the process.
+ */
+bool runSolveServer(const std::string &socketPath, unsigned int workers, SolutionCache *cache = nullptr);
+
+#endif // SOLVESERVER_H
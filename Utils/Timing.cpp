@@ -0,0 +1,49 @@
+#include "Timing.h"
+#include <sys/resource.h>
+#include <time.h>
+
+static double toMs(const struct timespec &time)
+{
+    return time.tv_sec * 1e3 + time.tv_nsec / 1e6;
+}
+
+static double toMs(const struct timeval &time)
+{
+    return time.tv_sec * 1e3 + time.tv_usec / 1e3;
+}
+
+// CPU time of the calling thread, and its user and system parts
+static void threadTimes(double &cpuMs, double &userMs, double &sysMs)
+{
+    struct timespec cpu = {0, 0};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu);
+    cpuMs = toMs(cpu);
+
+    struct rusage usage = {};
+    getrusage(RUSAGE_THREAD, &usage);
+    userMs = toMs(usage.ru_utime);
+    sysMs = toMs(usage.ru_stime);
+}
+
+Stopwatch::Stopwatch()
+{
+    restart();
+}
+
+void Stopwatch::restart()
+{
+    threadTimes(cpu_start, user_start, sys_start);
+    wall_start = std::chrono::steady_clock::now();
+}
+
+TimingSample Stopwatch::elapsed() const
+{
+    auto wallEnd = std::chrono::steady_clock::now();
+    TimingSample sample;
+    threadTimes(sample.cpu_ms, sample.user_ms, sample.sys_ms);
+    sample.wall_ms = std::chrono::duration<double, std::milli>(wallEnd - wall_start).count();
+    sample.cpu_ms -= cpu_start;
+    sample.user_ms -= user_start;
+    sample.sys_ms -= sys_start;
+    return sample;
+}
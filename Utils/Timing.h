@@ -0,0 +1,72 @@
+/**
+ * @file Timing.h
+ * @brief Wall-clock and per-thread CPU time of the compute phase of a solver
+ */
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <chrono>
+
+/**
+ * @brief Time taken by one measured region
+ * @var TimingSample::wall_ms Elapsed steady-clock time in milliseconds
+ * @var TimingSample::cpu_ms CPU time of the measuring thread (CLOCK_THREAD_CPUTIME_ID)
+ * @var TimingSample::user_ms Part of that CPU time spent in user mode
+ * @var TimingSample::sys_ms Part of that CPU time spent in the kernel
+ */
+struct TimingSample
+{
+    double wall_ms = 0.0;
+    double cpu_ms = 0.0;
+    double user_ms = 0.0;
+    double sys_ms = 0.0;
+};
+
+/**
+ * @brief Measures wall-clock time and the CPU time of the thread that created it
+ * @note CPU time is per thread: work a solver hands to other threads (the portfolio, parallel
+ *       annealing chains) shows up in wall_ms only.
+ * @note Keep progress bars, prompts and output outside the measured region.
+ */
+class Stopwatch
+{
+private:
+    std::chrono::steady_clock::time_point wall_start;
+    double cpu_start;
+    double user_start;
+    double sys_start;
+
+public:
+    /**
+     * @brief Creates a stopwatch and starts it
+     */
+    Stopwatch();
+
+    /**
+     * @brief Starts measuring again from now
+     */
+    void restart();
+
+    /**
+     * @brief Time since the stopwatch was started
+     * @return Wall-clock, CPU, user and system time in milliseconds
+     * @note Must be called from the thread that started the stopwatch.
+     */
+    TimingSample elapsed() const;
+};
+
+/**
+ * @brief Runs a function and measures it
+ * @param work Function to run
+ * @return Its wall-clock, CPU, user and system time
+ */
+template <typename Work>
+TimingSample timeCall(Work &&work)
+{
+    Stopwatch stopwatch;
+    work();
+    return stopwatch.elapsed();
+}
+
+#endif // TIMING_H
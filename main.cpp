@@ -5,15 +5,21 @@
  * This file contains the main function that initializes and launches
  * the Truck Packing Optimization application, which solves the knapsack
  * problem for logistics optimization using various algorithms.
+ * Without arguments the interactive menu starts; with arguments the tool
+ * runs headless (see CommandLine.h).
  */
 
 #include <iostream>
 #include "Menu/Menu.h"
+#include "Menu/CommandLine.h"
 #include "ReadData/read.h"
 #include "Approaches/DynamicProgramming.h"
 
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1)
+        return runCommandLine(argc, argv);
+
     std::cout << std::endl
               << "Hello user!" << std::endl;
     std::cout << "Welcome to the Truck Packing Optimization Tool!" << std::endl